@@ -0,0 +1,338 @@
+#ifndef AIRCRAFTLAYOUT_HPP
+#define AIRCRAFTLAYOUT_HPP
+
+#include <string>
+#include <vector>
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <cctype>
+
+using namespace std;
+
+// ==========================================
+// AIRCRAFT LAYOUT DESCRIPTORS
+// Description: Describes the cabin the systems work on:
+// 1. Number of seat columns (A, B, C, ...) and where the aisles are.
+// 2. Which rows belong to First / Business / Economy.
+// 3. Seats that can never be sold (blocked: exits, galleys, crew rest).
+//
+// Two forms exist:
+// - FixedLayout<...>  : compile-time (constexpr) tables for common cabins.
+// - AircraftLayout    : runtime copy used by the systems, loaded at startup
+//                       from a preset or from aircraft_layout.cfg.
+// Both answer "which class is row R" with a single table lookup. While the
+// active layout is one of the presets, AircraftLayout's hot queries
+// (classOfRow, validate, isBlocked, columnCount) go straight to the
+// preset's constexpr table instead of its own vectors.
+// ==========================================
+
+// Class codes (index into per-class arrays)
+enum SeatClassCode {
+    CLASS_FIRST = 0,
+    CLASS_BUSINESS = 1,
+    CLASS_ECONOMY = 2,
+    CLASS_COUNT = 3,
+    CLASS_NONE = 3      // Row without a class zone (accepts any ticket)
+};
+
+const int MAX_LAYOUT_COLS = 16; // Column letters A-P (fits a 32-bit row mask)
+
+inline int classCode(const string& fclass) {
+    if (fclass == "First") return CLASS_FIRST;
+    if (fclass == "Business") return CLASS_BUSINESS;
+    if (fclass == "Economy") return CLASS_ECONOMY;
+    return CLASS_NONE;
+}
+
+inline string className(int code) {
+    if (code == CLASS_FIRST) return "First";
+    if (code == CLASS_BUSINESS) return "Business";
+    if (code == CLASS_ECONOMY) return "Economy";
+    return "None";
+}
+
+// ==========================================
+// COMPILE-TIME LAYOUTS (constexpr specializations)
+// Template arguments: columns, aisle mask (bit c = aisle after column c),
+// last First row, last Business row, total rows. Everything after the
+// Business zone is Economy.
+// ==========================================
+template <int TotalRows>
+constexpr array<unsigned char, TotalRows + 1> makeRowClassTable(int firstEnd, int businessEnd) {
+    array<unsigned char, TotalRows + 1> table{};
+    table[0] = CLASS_NONE;
+    for (int r = 1; r <= TotalRows; r++) {
+        if (r <= firstEnd) table[r] = CLASS_FIRST;
+        else if (r <= businessEnd) table[r] = CLASS_BUSINESS;
+        else table[r] = CLASS_ECONOMY;
+    }
+    return table;
+}
+
+template <int Cols, unsigned AisleMask, int FirstEnd, int BusinessEnd, int TotalRows>
+struct FixedLayout {
+    static_assert(Cols > 0 && Cols <= MAX_LAYOUT_COLS, "Unsupported column count");
+    static_assert(FirstEnd <= BusinessEnd && BusinessEnd <= TotalRows, "Class zones out of order");
+
+    static constexpr int COLS = Cols;
+    static constexpr unsigned AISLES = AisleMask;
+    static constexpr int FIRST_END = FirstEnd;
+    static constexpr int BUSINESS_END = BusinessEnd;
+    static constexpr int ROWS = TotalRows;
+    static constexpr array<unsigned char, TotalRows + 1> ROW_CLASS = makeRowClassTable<TotalRows>(FirstEnd, BusinessEnd);
+
+    // Rows past the end behave like the last row (the old "Economy is 11+" rule)
+    static constexpr int classOfRow(int row) {
+        return row < 1 ? (int)CLASS_NONE : ROW_CLASS[row > ROWS ? ROWS : row];
+    }
+    static constexpr bool validate(int row, int cls) {
+        return classOfRow(row) == CLASS_NONE || classOfRow(row) == cls;
+    }
+    static constexpr int seatIndex(int row, int col) { return (row - 1) * COLS + col; }
+    static constexpr bool aisleAfter(int col) { return (AISLES >> col) & 1u; }
+};
+
+// Narrow-body 3-3 (A320/737 style): the original 30-row cabin of this project
+using NarrowBody33 = FixedLayout<6, (1u << 2), 3, 10, 30>;
+// Wide-body 3-4-3 (777/A350 style): aisles after C and G
+using WideBody343 = FixedLayout<10, (1u << 2) | (1u << 6), 4, 12, 50>;
+
+static_assert(NarrowBody33::validate(2, CLASS_FIRST) && !NarrowBody33::validate(11, CLASS_FIRST), "Narrow-body zones");
+static_assert(WideBody343::seatIndex(2, 3) == 13, "Wide-body indexing");
+
+// Which FixedLayout an AircraftLayout is identical to (CUSTOM = none)
+enum LayoutPresetCode {
+    LAYOUT_CUSTOM = 0,
+    LAYOUT_NARROW_33 = 1,
+    LAYOUT_WIDE_343 = 2
+};
+
+// ==========================================
+// RUNTIME LAYOUT (AircraftLayout)
+// ==========================================
+struct AircraftLayout {
+    string name = "Narrow-body 3-3";
+    int cols = 6;
+    unsigned aisleMask = (1u << 2);
+    int totalRows = 30;
+    int classStart[CLASS_COUNT] = { 1, 4, 11 };
+    int classEnd[CLASS_COUNT] = { 3, 10, 30 };
+
+    vector<unsigned char> rowClass;   // [0..totalRows] -> class code
+    vector<unsigned> blockedMask;     // [0..totalRows] -> bit c = seat blocked
+    int preset = LAYOUT_CUSTOM;       // FixedLayout this cabin matches (hot-path dispatch)
+
+    AircraftLayout() { rebuild(); }
+
+    // Recompute the lookup tables after the ranges or blocked seats were edited
+    void rebuild() {
+        rowClass.assign(totalRows + 1, CLASS_NONE);
+        for (int c = 0; c < CLASS_COUNT; c++) {
+            for (int r = classStart[c]; r <= classEnd[c] && r <= totalRows; r++) {
+                if (r >= 1) rowClass[r] = (unsigned char)c;
+            }
+        }
+        blockedMask.resize(totalRows + 1, 0);
+        preset = LAYOUT_CUSTOM;
+        if (matches<NarrowBody33>()) preset = LAYOUT_NARROW_33;
+        else if (matches<WideBody343>()) preset = LAYOUT_WIDE_343;
+    }
+
+    // True if this cabin is exactly the FixedLayout (same zones, no blocked seats)
+    template <typename Fixed>
+    bool matches() const {
+        if (cols != Fixed::COLS || aisleMask != Fixed::AISLES || totalRows != Fixed::ROWS) return false;
+        if (classStart[CLASS_FIRST] != 1 || classEnd[CLASS_FIRST] != Fixed::FIRST_END) return false;
+        if (classStart[CLASS_BUSINESS] != Fixed::FIRST_END + 1 || classEnd[CLASS_BUSINESS] != Fixed::BUSINESS_END) return false;
+        if (classStart[CLASS_ECONOMY] != Fixed::BUSINESS_END + 1 || classEnd[CLASS_ECONOMY] != Fixed::ROWS) return false;
+        for (unsigned m : blockedMask) {
+            if (m != 0) return false;
+        }
+        return true;
+    }
+
+    template <typename Fixed>
+    static AircraftLayout fromFixed(const string& layoutName) {
+        AircraftLayout l;
+        l.name = layoutName;
+        l.cols = Fixed::COLS;
+        l.aisleMask = Fixed::AISLES;
+        l.totalRows = Fixed::ROWS;
+        l.classStart[CLASS_FIRST] = 1;                      l.classEnd[CLASS_FIRST] = Fixed::FIRST_END;
+        l.classStart[CLASS_BUSINESS] = Fixed::FIRST_END + 1; l.classEnd[CLASS_BUSINESS] = Fixed::BUSINESS_END;
+        l.classStart[CLASS_ECONOMY] = Fixed::BUSINESS_END + 1; l.classEnd[CLASS_ECONOMY] = Fixed::ROWS;
+        l.rowClass.assign(Fixed::ROW_CLASS.begin(), Fixed::ROW_CLASS.end());
+        l.blockedMask.assign(Fixed::ROWS + 1, 0);
+        l.preset = LAYOUT_CUSTOM;
+        if (l.matches<NarrowBody33>()) l.preset = LAYOUT_NARROW_33;
+        else if (l.matches<WideBody343>()) l.preset = LAYOUT_WIDE_343;
+        return l;
+    }
+
+    int classOfRow(int row) const {
+        if (preset == LAYOUT_NARROW_33) return NarrowBody33::classOfRow(row);
+        if (preset == LAYOUT_WIDE_343) return WideBody343::classOfRow(row);
+        if (row < 1) return CLASS_NONE;
+        return rowClass[row > totalRows ? totalRows : row];
+    }
+
+    bool validate(int row, int cls) const {
+        if (preset == LAYOUT_NARROW_33) return NarrowBody33::validate(row, cls);
+        if (preset == LAYOUT_WIDE_343) return WideBody343::validate(row, cls);
+        int zone = classOfRow(row);
+        return zone == CLASS_NONE || zone == cls;
+    }
+
+    bool isBlocked(int row, int col) const {
+        if (preset != LAYOUT_CUSTOM) return false; // Presets have no blocked seats
+        if (row < 1 || row > totalRows || col < 0 || col >= cols) return false;
+        return (blockedMask[row] >> col) & 1u;
+    }
+
+    int columnCount() const {
+        if (preset == LAYOUT_NARROW_33) return NarrowBody33::COLS;
+        if (preset == LAYOUT_WIDE_343) return WideBody343::COLS;
+        return cols;
+    }
+
+    bool aisleAfter(int col) const { return (aisleMask >> col) & 1u; }
+
+    int seatIndex(int row, int col) const { return (row - 1) * cols + col; }
+
+    // Short label used on the seat map ("Fst", "Bus", "Eco")
+    string rowLabel(int row) const {
+        int c = classOfRow(row);
+        if (c == CLASS_FIRST) return "Fst";
+        if (c == CLASS_BUSINESS) return "Bus";
+        if (c == CLASS_ECONOMY) return "Eco";
+        return "---";
+    }
+
+    // e.g. "Rows 4-10"
+    string zoneText(int cls) const {
+        if (cls < 0 || cls >= CLASS_COUNT || classStart[cls] > classEnd[cls]) return "not available";
+        if (classStart[cls] == classEnd[cls]) return "Row " + to_string(classStart[cls]);
+        return "Rows " + to_string(classStart[cls]) + "-" + to_string(classEnd[cls]);
+    }
+};
+
+// ==========================================
+// PRESETS & LAYOUT FILE
+// ==========================================
+inline bool layoutPreset(const string& preset, AircraftLayout& out) {
+    if (preset == "narrow-33") { out = AircraftLayout::fromFixed<NarrowBody33>("Narrow-body 3-3"); return true; }
+    if (preset == "wide-343") { out = AircraftLayout::fromFixed<WideBody343>("Wide-body 3-4-3"); return true; }
+    return false;
+}
+
+// Parse "4-10" or "7" into a row range
+inline bool parseRowRange(const string& text, int& start, int& end) {
+    size_t dash = text.find('-');
+    try {
+        if (dash == string::npos) { start = end = stoi(text); }
+        else { start = stoi(text.substr(0, dash)); end = stoi(text.substr(dash + 1)); }
+    } catch (...) { return false; }
+    return start >= 1 && start <= end;
+}
+
+inline string trimLayoutText(const string& s) {
+    size_t b = s.find_first_not_of(" \t\r");
+    if (b == string::npos) return "";
+    size_t e = s.find_last_not_of(" \t\r");
+    return s.substr(b, e - b + 1);
+}
+
+// Function: Load Layout File
+// Format: one "key=value" per line, '#' starts a comment.
+//   preset=narrow-33 | wide-343   (optional, other keys override it)
+//   name=A320      columns=6      aisles=C      rows=30
+//   first=1-3      business=4-10  economy=11-30
+//   blocked=1B,1E,12A
+// Returns false (and leaves 'out' untouched) if the file is missing or invalid.
+inline bool loadLayoutFile(const string& filename, AircraftLayout& out) {
+    ifstream file(filename);
+    if (!file.is_open()) return false;
+
+    AircraftLayout l;
+    vector<string> blockedSeats;
+    bool rangesGiven[CLASS_COUNT] = { false, false, false };
+    string line;
+    int lineNo = 0;
+
+    while (getline(file, line)) {
+        lineNo++;
+        size_t hash = line.find('#');
+        if (hash != string::npos) line = line.substr(0, hash);
+        line = trimLayoutText(line);
+        if (line.empty()) continue;
+
+        size_t eq = line.find('=');
+        if (eq == string::npos) {
+            cout << ">> [Layout] " << filename << ":" << lineNo << " ignored (expected key=value)." << endl;
+            continue;
+        }
+        string key = trimLayoutText(line.substr(0, eq));
+        string val = trimLayoutText(line.substr(eq + 1));
+        bool ok = true;
+
+        if (key == "preset") ok = layoutPreset(val, l);
+        else if (key == "name") l.name = val;
+        else if (key == "columns") { try { l.cols = stoi(val); } catch (...) { ok = false; } }
+        else if (key == "rows") { try { l.totalRows = stoi(val); } catch (...) { ok = false; } }
+        else if (key == "aisles") {
+            l.aisleMask = 0;
+            for (char ch : val) {
+                if (ch >= 'A' && ch < 'A' + MAX_LAYOUT_COLS) l.aisleMask |= 1u << (ch - 'A');
+                else if (ch != ',' && ch != ' ') ok = false;
+            }
+        }
+        else if (key == "first" || key == "business" || key == "economy") {
+            int c = key == "first" ? CLASS_FIRST : (key == "business" ? CLASS_BUSINESS : CLASS_ECONOMY);
+            ok = parseRowRange(val, l.classStart[c], l.classEnd[c]);
+            rangesGiven[c] = ok;
+        }
+        else if (key == "blocked") {
+            size_t pos = 0;
+            while (pos <= val.size()) {
+                size_t comma = val.find(',', pos);
+                if (comma == string::npos) comma = val.size();
+                string seat = trimLayoutText(val.substr(pos, comma - pos));
+                if (!seat.empty()) blockedSeats.push_back(seat);
+                pos = comma + 1;
+            }
+        }
+        else ok = false;
+
+        if (!ok) {
+            cout << ">> [Layout] " << filename << ":" << lineNo << " invalid entry '" << line << "'." << endl;
+            return false;
+        }
+    }
+
+    if (l.cols < 1 || l.cols > MAX_LAYOUT_COLS || l.totalRows < 1) {
+        cout << ">> [Layout] " << filename << ": columns must be 1-" << MAX_LAYOUT_COLS << " and rows >= 1." << endl;
+        return false;
+    }
+    // Economy runs to the last row unless given explicitly
+    if (!rangesGiven[CLASS_ECONOMY] && l.classEnd[CLASS_ECONOMY] != l.totalRows) l.classEnd[CLASS_ECONOMY] = l.totalRows;
+    l.rebuild();
+
+    for (const string& seat : blockedSeats) {
+        int row = 0;
+        size_t i = 0;
+        while (i < seat.size() && isdigit((unsigned char)seat[i])) row = row * 10 + (seat[i++] - '0');
+        int col = (i + 1 == seat.size()) ? toupper((unsigned char)seat[i]) - 'A' : -1;
+        if (row < 1 || row > l.totalRows || col < 0 || col >= l.cols) {
+            cout << ">> [Layout] " << filename << ": blocked seat '" << seat << "' is outside the cabin." << endl;
+            return false;
+        }
+        l.blockedMask[row] |= 1u << col;
+    }
+    if (!blockedSeats.empty()) l.preset = LAYOUT_CUSTOM; // Blocked seats: not a preset any more
+
+    out = l;
+    return true;
+}
+
+#endif
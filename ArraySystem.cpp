@@ -1,7 +1,15 @@
 #include "FlightCommon.hpp"
+#include "IDScan.hpp"
+#include "ScanPool.hpp"
+#include "WaitlistRing.hpp"
+#include "TimingWheel.hpp"
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <vector>
+#include <unordered_set>
+#include <unordered_map>
+#include <chrono>
 
 using namespace std;
 
@@ -11,20 +19,61 @@ using namespace std;
 // Key Features:
 // 1. 2D Array for visual Seat Map (Fast Access O(1)).
 // 2. 1D Array for Passenger Manifest (Linear Search).
-// 3. Singly Linked List for Waitlist (Requirement).
+// 3. Ring-buffer Waitlist: contiguous FIFO with an ID -> sequence map
+//    (O(1) queue position and cancellation by ID).
+// 4. Tombstone deletion: cancelled slots become nullptr and are reused,
+//    with a batched compaction instead of shifting on every removal.
+// 5. Packed 8-byte ID keys next to passengerList: the linear search runs a
+//    SIMD kernel over them instead of comparing strings, split across a
+//    worker pool on large flights.
+// 6. Seat holds: a held seat is marked "(HOLD)" in the map; expiries sit
+//    in a hierarchical timing wheel (1 tick = 1 second).
+// 7. Copy-on-write snapshots of the seat grid, republished on every seat
+//    change, for readers on other threads (and the seat map screen).
 // ==========================================
-class ArraySystem : public FlightSystem {
+class ArraySystem final : public FlightSystem {
 private:
     string** seatMap;            // 2D Dynamic Array for Seating Grid [Rows][Cols]
     int maxRows;                 // Current maximum rows (Expandable)
     Passenger** passengerList;   // 1D Dynamic Array for storing Passenger Objects
+    uint64_t* idKeys;            // IDScan::pack(ID) per slot, 0 = empty (same size as passengerList)
     int passengerCapacity;       // Current capacity of the list
     int currentCount;            // Current number of passengers
+    int slotCount;               // Slots in use in passengerList (passengers + tombstones)
+    vector<int> freeSlots;       // Tombstone slots available for reuse (stack)
+    unordered_map<string, int> slotByID; // Passenger ID -> slot in passengerList
+    bool tombstoneDeletes;       // false = old behaviour (shift left on every removal)
+    bool indexedSearch;          // Opt-in: searchPassenger answers seated IDs from slotByID, not the scan
+    int scanThreads;             // Threads for searchPassenger's scan (1 = single-threaded)
+    ScanPool* scanPool;          // Created on the first parallel scan
+    SeatOccupancy occupancy;     // Bitmask copy of seatMap (free-seat finder)
+    NameIndex nameIndex;         // Name search index (seated + waitlisted)
+    RowBucketIndex buckets;      // Per-row buckets of seated passengers (range queries)
+    SnapshotPublisher snapshots; // Immutable seat-grid views for readers
+    WaitlistTally waitTally;     // Waitlist depth per class (stats)
+    ChangeFeed feed;             // Event stream of reservation changes
 
-    // --- Waitlist Variables (Singly Linked List) ---
+    // --- Waitlist (Ring Buffer) ---
     // Stores passengers who are waiting for a seat when the flight is full.
-    WaitlistNode* waitlistHead;
-    WaitlistNode* waitlistTail;
+    WaitlistRing waitlist;
+    bool priorityMode;                           // Promote by class / tier instead of queue head
+    WaitlistHeap<long long> waitHeaps[CLASS_COUNT]; // Priority mode: ring sequence numbers per class
+
+    // --- Seat Holds (Timing Wheel) ---
+    struct SeatHold {
+        string id;
+        string name;
+        int row = 0;
+        string col;
+        string flightClass;
+        int timer = -1;           // Timer id in holdWheel (for cancel)
+        long long expiresAt = 0;  // Wheel tick
+    };
+    unordered_map<string, SeatHold> holds;   // Holder ID -> hold
+    TimingWheel<string> holdWheel;           // Payload = holder ID
+    chrono::steady_clock::time_point holdClockStart;
+    bool manualHoldClock;                    // Benchmark: ticks only move through expireHoldsAt()
+    int heldByZone[CLASS_COUNT];             // Held seats per cabin zone (stats)
 
     // ==========================================
     // HELPER: Dynamic Array Expansion
@@ -38,18 +87,18 @@ private:
         // Double the size or add buffer
         int newMax = (requiredRow > maxRows * 2) ? requiredRow + 10 : maxRows * 2;
 
-        cout << ">> [System] Expanding Seat Map from " << maxRows << " to " << newMax << " rows..." << endl;
+        Log::info() << ">> [System] Expanding Seat Map from " << maxRows << " to " << newMax << " rows...";
 
         // 1. Allocate new 2D Array
         string** newMap = new string*[newMax];
         for (int i = 0; i < newMax; i++) {
-            newMap[i] = new string[FlightGlobal::COLS]; 
-            for (int j = 0; j < FlightGlobal::COLS; j++) newMap[i][j] = "EMPTY"; 
+            newMap[i] = new string[FlightGlobal::cols()]; 
+            for (int j = 0; j < FlightGlobal::cols(); j++) newMap[i][j] = "EMPTY"; 
         }
 
         // 2. Copy data from old map
         for (int i = 0; i < maxRows; i++) {
-            for (int j = 0; j < FlightGlobal::COLS; j++) {
+            for (int j = 0; j < FlightGlobal::cols(); j++) {
                 newMap[i][j] = seatMap[i][j];
             }
             delete[] seatMap[i]; // Delete old row memory
@@ -67,16 +116,210 @@ private:
         int newCap = passengerCapacity * 2;
         Passenger** newList = new Passenger*[newCap];
         
+        uint64_t* newKeys = new uint64_t[newCap];
+        
         // Copy pointers
-        for (int i = 0; i < currentCount; i++) newList[i] = passengerList[i];
+        for (int i = 0; i < slotCount; i++) {
+            newList[i] = passengerList[i];
+            newKeys[i] = idKeys[i];
+        }
         // Initialize rest to null
-        for (int i = currentCount; i < newCap; i++) newList[i] = nullptr;
+        for (int i = slotCount; i < newCap; i++) {
+            newList[i] = nullptr;
+            newKeys[i] = 0;
+        }
         
         delete[] passengerList;
+        delete[] idKeys;
         passengerList = newList;
+        idKeys = newKeys;
         passengerCapacity = newCap;
     }
 
+    // ==========================================
+    // HELPER: Tombstone Deletion
+    // A removal only nulls its slot (O(1) after the search). Tombstones are
+    // reused by addPassenger and squeezed out in one O(N) pass once they make
+    // up a quarter of the used slots, so a mass cancellation costs O(N) moves
+    // in total instead of O(N) per passenger.
+    // ==========================================
+    static constexpr int MIN_TOMBSTONES_TO_COMPACT = 64;
+
+    // Below this many slots one thread scans faster than waking the pool
+    // (~2 MB of keys, tens of microseconds single-threaded)
+    static constexpr int PARALLEL_SCAN_MIN = 1 << 18;
+
+    int tombstoneCount() const { return slotCount - currentCount; }
+
+    // Function: Compact Passenger List (stable, keeps manifest order)
+    void compactPassengerList() {
+        int write = 0;
+        for (int i = 0; i < slotCount; i++) {
+            if (passengerList[i] == nullptr) continue;
+            if (i != write) slotByID[passengerList[i]->passengerID] = write; // Keep ID index in sync
+            idKeys[write] = idKeys[i];
+            passengerList[write++] = passengerList[i];
+        }
+        for (int i = write; i < slotCount; i++) {
+            passengerList[i] = nullptr;
+            idKeys[i] = 0;
+        }
+        slotCount = write;
+        freeSlots.clear();
+    }
+
+    // Function: Rebuild ID -> slot and the ID keys after the list was reordered (sorting)
+    void reindexSlots() {
+        for (int i = 0; i < slotCount; i++) {
+            if (passengerList[i] != nullptr) {
+                slotByID[passengerList[i]->passengerID] = i;
+                idKeys[i] = IDScan::pack(passengerList[i]->passengerID);
+            } else {
+                idKeys[i] = 0;
+            }
+        }
+    }
+
+    // Function: Take the slot at 'index' out of the list
+    void releaseSlot(int index) {
+        if (!tombstoneDeletes) {
+            // Original behaviour: shift elements left to fill the gap
+            // (every shifted passenger also moves in the ID index)
+            for (int i = index; i < slotCount - 1; i++) {
+                passengerList[i] = passengerList[i + 1];
+                idKeys[i] = idKeys[i + 1];
+                slotByID[passengerList[i]->passengerID] = i;
+            }
+            passengerList[--slotCount] = nullptr;
+            idKeys[slotCount] = 0;
+            return;
+        }
+        passengerList[index] = nullptr;
+        idKeys[index] = 0;
+        if (index == slotCount - 1) slotCount--; // Last slot: nothing to leave behind
+        else freeSlots.push_back(index);
+
+        if (tombstoneCount() >= MIN_TOMBSTONES_TO_COMPACT && tombstoneCount() * 4 > slotCount) {
+            compactPassengerList();
+        }
+    }
+
+    // Function: Clear a seat in the map, bitmasks and row buckets
+    void vacateSeat(int row, const string& col) {
+        int rIndex = row - 1;
+        int cIndex = FlightGlobal::getColIndex(col);
+        if (rIndex >= 0 && rIndex < maxRows && cIndex != -1) {
+            seatMap[rIndex][cIndex] = "EMPTY";
+            occupancy.release(row, cIndex);
+            buckets.clear(row, cIndex);
+            snapshots.clearSeat(row, cIndex);
+            snapshots.publish();
+        }
+    }
+
+    // ==========================================
+    // HELPER: Waitlist Order
+    // FIFO: the head of the ring. Priority mode: the top of the freed
+    // seat's class heap (fare-paid before standby, then arrival).
+    // ==========================================
+    void enqueueWaiter(const string& id, const string& name, int row, const string& col, const string& fclass, int priority) {
+        long long seq = waitlist.push(id, name, row, col, fclass, priority);
+        waitTally.join(fclass);
+        feed.publish(CHANGE_WAIT_JOIN, id, name, row, col, fclass);
+        int cls = classCode(fclass);
+        if (priorityMode && cls != CLASS_NONE) waitHeaps[cls].push(seq, priority, seq);
+    }
+
+    void removeWaiter(long long seq) {
+        WaitlistEntry* w = waitlist.at(seq);
+        if (w == nullptr) return;
+        int cls = classCode(w->flightClass);
+        if (cls != CLASS_NONE) waitHeaps[cls].erase(seq);
+        waitTally.leave(w->flightClass);
+        waitlist.removeAt(seq);
+    }
+
+    // Heaps hold ring sequence numbers: rebuilt after compaction renumbers them
+    void rebuildWaitHeaps() {
+        for (int c = 0; c < CLASS_COUNT; c++) waitHeaps[c].clear();
+        if (!priorityMode) return;
+        for (long long s = waitlist.firstSeq(); s < waitlist.endSeq(); s++) {
+            WaitlistEntry* w = waitlist.at(s);
+            int cls = w != nullptr ? classCode(w->flightClass) : CLASS_NONE;
+            if (cls != CLASS_NONE) waitHeaps[cls].push(s, w->priority, s);
+        }
+    }
+
+    void compactWaitlist() {
+        if (waitlist.compact()) rebuildWaitHeaps();
+    }
+
+    // Function: Give a freed seat to the next waiter of the seat's class
+    // (queue order, or the best one in priority mode). A waiter leaves the
+    // line only once the booking went through; if it fails, the next one
+    // of the class is tried. False if nobody could take the seat.
+    bool fillFreedSeat(int row, const string& col) {
+        int cls = FlightGlobal::layout().classOfRow(row);
+        if (cls == CLASS_NONE) return false;
+
+        vector<long long> stay; // Priority mode: failed bookings, back into the heap afterwards
+        long long scanFrom = waitlist.firstSeq();
+        bool filled = false;
+        while (!filled) {
+            long long next = -1;
+            if (priorityMode) {
+                if (waitHeaps[cls].empty()) break;
+                next = waitHeaps[cls].top();
+                waitHeaps[cls].pop();
+            } else {
+                for (long long s = scanFrom; s < waitlist.endSeq() && next == -1; s++) {
+                    WaitlistEntry* w = waitlist.at(s);
+                    if (w != nullptr && classCode(w->flightClass) == cls) next = s;
+                }
+                if (next == -1) break;
+                scanFrom = next + 1;
+            }
+
+            // Copied out first: addPassenger may append to the ring.
+            WaitlistEntry first = *waitlist.at(next);
+            Log::info() << ">> [Auto-Fill] Seat " << row << col << " freed. Moving " << first.name << " from Waitlist.";
+
+            // Use the row and column that were just freed
+            if (addPassenger(first.id, first.name, row, col, first.flightClass)) {
+                nameIndex.remove(first.id, true); // Indexed as seated by addPassenger
+                feed.publish(CHANGE_PROMOTE, first.id, first.name, row, col, first.flightClass);
+                waitTally.leave(first.flightClass);
+                waitlist.removeAt(next);
+                filled = true;
+            } else if (priorityMode) {
+                stay.push_back(next);
+            }
+        }
+        for (long long seq : stay) waitHeaps[cls].push(seq, waitlist.at(seq)->priority, seq);
+        if (filled) compactWaitlist(); // Same tombstone threshold as cancelWaitlist
+        return filled;
+    }
+
+    // ==========================================
+    // HELPER: Seat Holds
+    // ==========================================
+
+    // Wheel tick for "now": whole seconds since the system was created
+    long long holdClock() const {
+        if (manualHoldClock) return holdWheel.currentTick();
+        return chrono::duration_cast<chrono::seconds>(chrono::steady_clock::now() - holdClockStart).count();
+    }
+
+    // Function: Drop a hold and clear its seat (the timer is already gone)
+    SeatHold takeHold(unordered_map<string, SeatHold>::iterator it) {
+        SeatHold h = it->second;
+        holds.erase(it);
+        int zone = FlightGlobal::layout().classOfRow(h.row);
+        if (zone != CLASS_NONE) heldByZone[zone]--;
+        vacateSeat(h.row, h.col);
+        return h;
+    }
+
     // ==========================================
     // HELPER: Merge Sort Implementation
     // ==========================================
@@ -126,29 +369,56 @@ private:
         merge(arr, left, mid, right);
     }
 
+    // --- Hooks for FlightSystem's shared seat features (auto-assign, group booking) ---
+    SeatOccupancy* seatOccupancy() override { return &occupancy; }
+
+    // Function: First group ID that already has a seat or a seat on hold
+    // (ID index + holds, O(K)); addPassenger rejects both
+    string findSeatedID(const unordered_set<string>& ids) override {
+        for (const string& id : ids) {
+            if (slotByID.count(id) || holds.count(id)) return id;
+        }
+        return "";
+    }
+
 public:
     // ==========================================
     // CONSTRUCTOR & DESTRUCTOR
     // ==========================================
     ArraySystem() {
         currentCount = 0;
-        maxRows = 30; // FIXED SIZE: A real plane size
+        slotCount = 0;
+        tombstoneDeletes = true;
+        indexedSearch = false;
+        scanThreads = (int)thread::hardware_concurrency();
+        if (scanThreads < 1) scanThreads = 1;
+        if (scanThreads > 8) scanThreads = 8;
+        scanPool = nullptr;
+        priorityMode = false;
+        holdClockStart = chrono::steady_clock::now();
+        manualHoldClock = false;
+        for (int c = 0; c < CLASS_COUNT; c++) heldByZone[c] = 0;
+        maxRows = FlightGlobal::totalRows(); // FIXED SIZE: Rows of the active aircraft layout
         passengerCapacity = 200; 
 
         // Initialize 2D Seat Map
         seatMap = new string*[maxRows];
         for (int i = 0; i < maxRows; i++) {
-            seatMap[i] = new string[FlightGlobal::COLS]; 
-            for (int j = 0; j < FlightGlobal::COLS; j++) seatMap[i][j] = "EMPTY"; 
+            seatMap[i] = new string[FlightGlobal::cols()]; 
+            for (int j = 0; j < FlightGlobal::cols(); j++) seatMap[i][j] = "EMPTY"; 
         }
 
+        occupancy.reset(FlightGlobal::layout());
+        buckets.reset(FlightGlobal::layout());
+        snapshots.reset(maxRows, FlightGlobal::cols());
+
         // Initialize 1D Passenger List
         passengerList = new Passenger*[passengerCapacity];
-        for(int i=0; i<passengerCapacity; i++) passengerList[i] = nullptr;
-
-        // Initialize Waitlist (Singly Linked List)
-        waitlistHead = nullptr;
-        waitlistTail = nullptr;
+        idKeys = new uint64_t[passengerCapacity];
+        for(int i=0; i<passengerCapacity; i++) {
+            passengerList[i] = nullptr;
+            idKeys[i] = 0;
+        }
 
         cout << ">> Array System Initialized." << endl;
     }
@@ -161,17 +431,12 @@ public:
         }
         // Free 1D Array Memory
         if (passengerList) {
-            for (int i = 0; i < currentCount; i++) delete passengerList[i];
+            for (int i = 0; i < slotCount; i++) delete passengerList[i]; // Tombstones are nullptr
             delete[] passengerList;
         }
-
-        // Free Waitlist Memory (Traverse Singly Linked List)
-        WaitlistNode* temp = waitlistHead;
-        while (temp != nullptr) {
-            WaitlistNode* next = temp->next;
-            delete temp;
-            temp = next;
-        }
+        delete[] idKeys;
+        delete scanPool;
+        // The waitlist ring frees itself
     }
 
     // ==========================================
@@ -181,12 +446,12 @@ public:
     
     // --- NEW VALIDATION ---
     if (!validateSeatClass(row, fclass)) {
-        cout << ">> [Error] Class Mismatch! " << fclass << " passengers cannot sit in Row " << row << "." << endl;
+        Log::error() << ">> [Error] Class Mismatch! " << fclass << " passengers cannot sit in Row " << row << ".";
         
-        // Optional: Suggest the correct rows
-        if (fclass == "First") cout << ">> [Hint] First Class is Rows 1-3." << endl;
-        else if (fclass == "Business") cout << ">> [Hint] Business Class is Rows 4-10." << endl;
-        else cout << ">> [Hint] Economy Class is Rows 11+." << endl;
+        // Optional: Suggest the correct rows (zones come from the aircraft layout)
+        int cls = classCode(fclass);
+        if (cls != CLASS_NONE) Log::warn() << ">> [Hint] " << fclass << " Class is " << FlightGlobal::layout().zoneText(cls) << ".";
+        else Log::warn() << ">> [Hint] Class must be First, Business or Economy.";
 
         return false;
     }
@@ -195,7 +460,7 @@ public:
         
     // Instead, just double check validity (though main.cpp handles this)
         if (row > maxRows) {
-            cout << ">> [Error] This plane only has " << maxRows << " rows." << endl;
+            Log::error() << ">> [Error] This plane only has " << maxRows << " rows.";
             return false;
         }
 
@@ -203,28 +468,43 @@ public:
         int cIndex = FlightGlobal::getColIndex(col);
 
         if (rIndex < 0 || cIndex == -1) {
-            cout << ">> [Error] Invalid Seat Position." << endl;
+            Log::error() << ">> [Error] Invalid Seat Position.";
+            return false;
+        }
+
+        // Blocked seats (exits, galleys...) are never sold
+        if (FlightGlobal::layout().isBlocked(row, cIndex)) {
+            Log::error() << ">> [Error] Seat " << row << col << " is blocked on this aircraft.";
             return false;
         }
 
         // SEAT COLLISION -> WAITLIST
         if (seatMap[rIndex][cIndex] != "EMPTY") {
-            cout << ">> [System] Seat " << row << col << " is occupied. Adding to Waitlist..." << endl;
+            Log::info() << ">> [System] Seat " << row << col << " is occupied. Adding to Waitlist...";
             addToWaitlist(id, name, row, col, fclass); // AUTOMATICALLY GO TO WAITLIST
             return false; 
         }
 
-        // 3. ID UNIQUENESS CHECK
-        // Disadvantage of Array: Must loop through entire list O(N)
-        for (int i = 0; i < currentCount; i++) {
-            if (passengerList[i]->passengerID == id) {
-                cout << ">> [Failed] Passenger ID " << id << " already exists (Holder: " << passengerList[i]->name << ")." << endl;
-                return false;
-            }
+        // 3. ID UNIQUENESS CHECK (ID index, O(1))
+        auto existing = slotByID.find(id);
+        if (existing != slotByID.end()) {
+            Log::warn() << ">> [Failed] Passenger ID " << id << " already exists (Holder: " << passengerList[existing->second]->name << ").";
+            return false;
+        }
+        if (holds.count(id)) {
+            Log::warn() << ">> [Failed] Passenger ID " << id << " has a seat on hold (confirm or release it first).";
+            return false;
         }
 
-        // 4. Resize List if Full
-        if (currentCount >= passengerCapacity) expandPassengerList();
+        // 4. Reuse a tombstone slot, or resize List if Full
+        int slot;
+        if (!freeSlots.empty()) {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            if (slotCount >= passengerCapacity) expandPassengerList();
+            slot = slotCount++;
+        }
 
         // 5. Create Object and Add to Arrays
         Passenger* newP = new Passenger;
@@ -234,10 +514,19 @@ public:
         newP->seatCol = col;
         newP->flightClass = fclass;
         
-        passengerList[currentCount++] = newP; // Store in 1D List
+        passengerList[slot] = newP;           // Store in 1D List
+        idKeys[slot] = IDScan::pack(id);      // Key for the SIMD scan
+        slotByID[id] = slot;
+        currentCount++;
         seatMap[rIndex][cIndex] = name;       // Store in 2D Map (Visuals)
+        occupancy.occupy(row, cIndex);        // Keep bitmasks in sync
+        buckets.place(newP, row, cIndex);
+        nameIndex.add(id, name, false);
+        snapshots.setSeat(row, cIndex, id, name, fclass);
+        snapshots.publish();
+        feed.publish(CHANGE_SEAT_ADD, id, name, row, col, fclass);
 
-        cout << ">> [Success] Passenger " << name << " (" << id << ") assigned to " << row << col << "." << endl;
+        Log::info() << ">> [Success] Passenger " << name << " (" << id << ") assigned to " << row << col << ".";
         return true;
     }
 
@@ -245,18 +534,13 @@ public:
 // FUNCTION: Remove Passenger (ARRAY VERSION)
 // ==========================================
     bool removePassenger(string id) override {
-    int targetIndex = -1;
-    
-    // 1. Find Passenger in Array (Linear Search)
-    for (int i = 0; i < currentCount; i++) {
-        if (passengerList[i] != nullptr && passengerList[i]->passengerID == id) {
-            targetIndex = i;
-            break;
-        }
-    }
+    // 1. Find Passenger's slot (ID index)
+    auto found = slotByID.find(id);
 
     // If not found
-    if (targetIndex == -1) return false;
+    if (found == slotByID.end()) return false;
+    int targetIndex = found->second;
+    slotByID.erase(found);
 
     // 2. Capture Data before Deletion (For Auto-Fill)
     Passenger* p = passengerList[targetIndex];
@@ -265,46 +549,23 @@ public:
     string freedClass = p->flightClass;
 
     // 3. Update Seat Map (Clear the seat)
-    int rIndex = freedRow - 1;
-    int cIndex = FlightGlobal::getColIndex(freedCol);
-    if (rIndex >= 0 && cIndex != -1) {
-        seatMap[rIndex][cIndex] = "EMPTY";
-    }
+    vacateSeat(freedRow, freedCol);
+    nameIndex.remove(id, false);
+    feed.publish(CHANGE_SEAT_REMOVE, id, p->name, freedRow, freedCol, freedClass);
 
-    // 4. Remove from Array (Shift elements left to fill gap)
+    // 4. Remove from Array (Tombstone; compacted in batches)
     delete passengerList[targetIndex]; // Free memory
-    for (int i = targetIndex; i < currentCount - 1; i++) {
-        passengerList[i] = passengerList[i + 1];
-    }
-    passengerList[currentCount - 1] = nullptr; // Clear last slot
     currentCount--;
+    releaseSlot(targetIndex);
 
-    cout << ">> [Success] Passenger " << id << " removed." << endl;
+    Log::info() << ">> [Success] Passenger " << id << " removed.";
 
     // ====================================================
     // 5. CHECK WAITLIST TO FILL THE BLANK (Fixed Version)
     // ====================================================
-    WaitlistNode* wPrev = nullptr;
-    WaitlistNode* wCurr = waitlistHead;
-
-    if (wCurr != nullptr) {
-        // Since we cannot store wantedRow/Col in the WaitlistNode without changing the header,
-        // we take the first person in line to fill the newly freed seat.
-        
-        cout << ">> [Auto-Fill] Seat " << freedRow << freedCol << " freed. Moving " << wCurr->name << " from Waitlist." << endl;
-        
-        // Use the row and column that were just freed
-        addPassenger(wCurr->id, wCurr->name, freedRow, freedCol, wCurr->flightClass);
-
-        // Remove the first person from Waitlist (Standard Singly Linked List Deletion)
-        WaitlistNode* toDelete = wCurr;
-        waitlistHead = wCurr->next; 
-        if (waitlistHead == nullptr) waitlistTail = nullptr; // Update tail if list became empty
-
-        delete toDelete;
-        return true; 
-    }
-
+    // The first person in line (priority mode: best waiter of this
+    // class) takes the newly freed seat.
+    fillFreedSeat(freedRow, freedCol);
     return true;
 }
 
@@ -313,30 +574,40 @@ public:
     // ==========================================
     Passenger* searchPassenger(const string& id) override {
         // 1. Search Main List (Array Linear Search)
-        for (int i = 0; i < currentCount; i++) {
-            if (passengerList[i] != nullptr && passengerList[i]->passengerID == id) {
-                return passengerList[i]; // Found in the main plane!
+        // Kept as a scan on purpose: menu option 3 measures linear search.
+        // The scan reads the packed ID keys (SIMD); a key match is confirmed
+        // against the real ID, since long IDs can share a key.
+        // setIndexedSearch(true) opts into the slotByID index instead (O(1)).
+        if (indexedSearch) {
+            auto found = slotByID.find(id);
+            if (found != slotByID.end()) return passengerList[found->second]; // Found in the main plane!
+        } else {
+            uint64_t key = IDScan::pack(id);
+            if (scanThreads > 1 && slotCount >= PARALLEL_SCAN_MIN) {
+                // Large flight: one slice of the keys per thread, all stop at the first match
+                if (scanPool == nullptr) scanPool = new ScanPool(scanThreads);
+                int i = parallelFindKey(*scanPool, idKeys, slotCount, key, [&](int slot) {
+                    return passengerList[slot] != nullptr && passengerList[slot]->passengerID == id;
+                });
+                if (i != -1) return passengerList[i]; // Found in the main plane!
+            } else {
+                for (int i = IDScan::find(idKeys, slotCount, key); i != -1; i = IDScan::find(idKeys, slotCount, key, i + 1)) {
+                    if (passengerList[i] != nullptr && passengerList[i]->passengerID == id) {
+                        return passengerList[i]; // Found in the main plane!
+                    }
+                }
             }
         }
 
-        // 2. Search Waitlist (Singly Linked List)
+        // 2. Search Waitlist (ID -> sequence map, O(1))
         // If we didn't find them in the array, check the waitlist
-        WaitlistNode* wTemp = waitlistHead;
-        while (wTemp != nullptr) {
-            if (wTemp->id == id) {
-                // Found in Waitlist!
-                // Use the same "Static Object Trick" to return a Passenger* pointer
-                static Passenger tempResult; 
-                
-                tempResult.passengerID = wTemp->id;
-                tempResult.name = wTemp->name + " [WAITLIST]";
-                tempResult.seatRow = 0;
-                tempResult.seatCol = "WL";
-                tempResult.flightClass = wTemp->flightClass;
-                
-                return &tempResult;
-            }
-            wTemp = wTemp->next;
+        WaitlistEntry* w = waitlist.find(id);
+        if (w != nullptr) {
+            // Found in Waitlist!
+            // Use the same "Static Object Trick" to return a Passenger* pointer
+            static Passenger tempResult; 
+            tempResult = waitlistRecord(w->id, w->name, w->flightClass);
+            return &tempResult;
         }
 
         return nullptr; // Not found in Array OR Waitlist
@@ -346,18 +617,13 @@ public:
     // FUNCTION 4: Display Seat Map
     // ==========================================
     void displaySeatingMap() override {
-        // Optimization: Calculate last used row to avoid printing 100+ empty rows
-        int lastActiveRow = 20; // Minimum default
-        for(int i = maxRows - 1; i >= 0; i--) {
-            bool rowEmpty = true;
-            for(int j = 0; j < FlightGlobal::COLS; j++) {
-                if(seatMap[i][j] != "EMPTY") { rowEmpty = false; break; }
-            }
-            if(!rowEmpty) { 
-                lastActiveRow = i + 1; 
-                break; 
-            }
-        }
+        // Rendered from the latest snapshot, not the live seat map
+        shared_ptr<const SeatSnapshot> view = snapshots.current();
+
+        // Optimization: Stop at the last used row to avoid printing 100+ empty rows
+        // (highest occupied row is kept by the occupancy bitmaps, no scan)
+        int lastActiveRow = occupancy.highestTakenRow();
+        if (lastActiveRow == 0) lastActiveRow = maxRows < 20 ? maxRows : 20; // Empty cabin: minimum default
 
         // Pagination Logic
         int totalPages = (lastActiveRow + FlightGlobal::ROWS_PER_PAGE - 1) / FlightGlobal::ROWS_PER_PAGE;
@@ -371,14 +637,7 @@ public:
             cout << "==========================================================================" << endl;
             cout << "                       FLIGHT SEATING MAP (ARRAY)                         " << endl;
             cout << "==========================================================================" << endl;
-            cout << "      " 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[A]" 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[B]" 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[C]" 
-                 << "    " 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[D]" 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[E]" 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[F]" << endl;
+            FlightGlobal::printSeatMapHeader();
             cout << "--------------------------------------------------------------------------" << endl;
 
             int startRow = (currentPage - 1) * FlightGlobal::ROWS_PER_PAGE;
@@ -387,19 +646,17 @@ public:
 
             // Render Rows
             for (int i = startRow; i < endRow; i++) {
-                string rowClass = "Eco"; 
-                if (i < 3) rowClass = "Fst";      
-                else if (i < 10) rowClass = "Bus"; 
+                string rowClass = FlightGlobal::layout().rowLabel(i + 1);
                 
                 cout << rowClass << setw(2) << setfill('0') << (i + 1) << setfill(' ') << " "; 
 
-                for (int j = 0; j < FlightGlobal::COLS; j++) {
-                    string display = FlightGlobal::formatName(seatMap[i][j]); 
+                for (int j = 0; j < FlightGlobal::cols(); j++) {
+                    string display = FlightGlobal::formatName(view->at(i + 1, j).label); 
                     // Truncate name if too long for the grid
                     if (display.length() > 12) display = display.substr(0, 9) + "..";
                     
                     cout << "[" << left << setw(10) << display << "] ";
-                    if (j == 2) cout << "    "; // Aisle gap
+                    if (FlightGlobal::layout().aisleAfter(j) && j < FlightGlobal::cols() - 1) cout << "    "; // Aisle gap
                 }
                 cout << endl;
             }
@@ -432,8 +689,8 @@ public:
                  << left << setw(15) << "Class" << endl;
             cout << "--------------------------------------------------------------" << endl;
 
-            for (int i = 0; i < currentCount; i++) {
-                if (passengerList[i]) {
+            for (int i = 0; i < slotCount; i++) {
+                if (passengerList[i]) { // Skip tombstones
                     string fullSeat = to_string(passengerList[i]->seatRow) + passengerList[i]->seatCol;
                     cout << left << setw(10) << passengerList[i]->passengerID 
                          << left << setw(20) << passengerList[i]->name 
@@ -443,16 +700,16 @@ public:
             }
         }
 
-        // 2. Display Waitlist (Singly Linked List) - THIS WAS MISSING
-        cout << "\n------------------ WAITLIST (Singly Linked List) ------------------" << endl;
-        if (waitlistHead == nullptr) {
+        // 2. Display Waitlist (Ring Buffer, queue order)
+        cout << "\n---------------------- WAITLIST (Ring Buffer) ----------------------" << endl;
+        if (waitlist.empty()) {
             cout << "(Empty)" << endl;
         } else {
-            WaitlistNode* temp = waitlistHead;
             int count = 1;
-            while (temp != nullptr) {
-                cout << count++ << ". " << temp->name << " (" << temp->id << ") - " << temp->flightClass << endl;
-                temp = temp->next;
+            for (long long s = waitlist.firstSeq(); s < waitlist.endSeq(); s++) {
+                WaitlistEntry* w = waitlist.at(s);
+                if (w == nullptr) continue; // Cancelled
+                cout << count++ << ". " << w->name << " (" << w->id << ") - " << w->flightClass << endl;
             }
         }
         
@@ -470,6 +727,7 @@ public:
             cout << ">> Not enough passengers to sort." << endl;
             return;
         }
+        compactPassengerList(); // Sorts work on a dense array
 
         // Standard Bubble Sort: Swaps adjacent elements if out of order
         for (int i = 0; i < currentCount - 1; i++) {
@@ -481,31 +739,347 @@ public:
                 }
             }
         }
+        reindexSlots();
         cout << ">> Sorted " << currentCount << " passengers by Name." << endl;
         displayManifest();
     }
 
     // ==========================================
-    // WAITLIST (Singly Linked List Implementation)
-    // Requirement: Must demonstrate Singly Linked List
+    // WAITLIST (Ring Buffer Implementation)
+    // Appends to the back of the ring (O(1) amortized); the requested
+    // row / column are kept with the entry.
     // ==========================================
     void addToWaitlist(string id, string name, int row, string col, string fclass) override {
-    WaitlistNode* newNode = new WaitlistNode;
-    newNode->id = id;
-    newNode->name = name;
-    newNode->row = row;    // Store the row
-    newNode->col = col;    // Store the col
-    newNode->flightClass = fclass;
-    newNode->next = nullptr;
+    enqueueWaiter(id, name, row, col, fclass, WAIT_FARE_PAID);
+    nameIndex.add(id, name, true);
+    Log::info() << ">> [Waitlist] " << name << " added for seat " << row << col << ".";
+    }
+
+    void addStandby(string id, string name, int row, string col, string fclass) override {
+        enqueueWaiter(id, name, row, col, fclass, WAIT_STANDBY);
+        nameIndex.add(id, name, true);
+        Log::info() << ">> [Waitlist] " << name << " added on standby for seat " << row << col << ".";
+    }
 
-    if (waitlistHead == nullptr) {
-        waitlistHead = newNode;
-        waitlistTail = newNode;
-    } else {
-        waitlistTail->next = newNode;
-        waitlistTail = newNode;
+    // Function: Switch between FIFO and priority promotion (heaps built from the ring)
+    bool setPriorityWaitlist(bool on) override {
+        priorityMode = on;
+        rebuildWaitHeaps();
+        return true;
     }
-    cout << ">> [Waitlist] " << name << " added for seat " << row << col << "." << endl;
+    bool priorityWaitlist() const override { return priorityMode; }
+
+    // Function: Place in line (ID map + Fenwick tree of cancelled entries)
+    int waitlistPosition(const string& id) override {
+        return waitlist.position(id);
+    }
+
+    // Function: Leave the waitlist without a seat (O(1): entry becomes a tombstone)
+    bool cancelWaitlist(const string& id) override {
+        WaitlistEntry* w = waitlist.find(id);
+        if (w == nullptr) return false;
+        nameIndex.remove(id, true);
+        feed.publish(CHANGE_WAIT_LEAVE, w->id, w->name, w->row, w->col, w->flightClass);
+        removeWaiter(w->seq);
+        compactWaitlist();
+        return true;
+    }
+    bool supportsCancelWaitlist() const override { return true; }
+
+    // ==========================================
+    // FEATURE: Seat Holds (Hierarchical Timing Wheel)
+    // Hold: seat marked "(HOLD)" in the map and the occupancy bitmasks (so
+    // bookings, auto-assign and groups skip it) plus one wheel timer, O(1).
+    // Confirm books the seat; release or expiry frees it for the waitlist.
+    // ==========================================
+    bool holdSeat(string id, string name, int row, string col, string fclass, int ttlSeconds) override {
+        expireHolds(); // Wheel up to date before the new expiry is filed
+
+        int cIndex = FlightGlobal::getColIndex(col);
+        if (!validateSeatClass(row, fclass)) {
+            Log::error() << ">> [Error] Class Mismatch! " << fclass << " passengers cannot sit in Row " << row << ".";
+            return false;
+        }
+        if (row < 1 || row > maxRows || cIndex == -1 || ttlSeconds < 1) {
+            Log::error() << ">> [Error] Invalid Seat Position or hold time.";
+            return false;
+        }
+        if (FlightGlobal::layout().isBlocked(row, cIndex)) {
+            Log::error() << ">> [Error] Seat " << row << col << " is blocked on this aircraft.";
+            return false;
+        }
+        if (seatMap[row - 1][cIndex] != "EMPTY") {
+            Log::warn() << ">> [Failed] Seat " << row << col << " is not free.";
+            return false;
+        }
+        if (slotByID.count(id) || holds.count(id)) {
+            Log::warn() << ">> [Failed] Passenger ID " << id << " already has a seat or a hold.";
+            return false;
+        }
+
+        SeatHold h;
+        h.id = id;
+        h.name = name;
+        h.row = row;
+        h.col = col;
+        h.flightClass = fclass;
+        h.expiresAt = holdWheel.currentTick() + ttlSeconds;
+        h.timer = holdWheel.schedule(id, h.expiresAt);
+        holds[id] = h;
+
+        seatMap[row - 1][cIndex] = "(HOLD)";
+        occupancy.occupy(row, cIndex);
+        int zone = FlightGlobal::layout().classOfRow(row);
+        if (zone != CLASS_NONE) heldByZone[zone]++;
+        snapshots.setSeat(row, cIndex, "", "(HOLD)", fclass);
+        snapshots.publish();
+
+        Log::info() << ">> [Hold] Seat " << row << col << " held for " << name << " (" << id << ") for " << ttlSeconds << "s.";
+        return true;
+    }
+
+    // Function: Turn a hold into a booking on the same seat
+    bool confirmHold(const string& id) override {
+        expireHolds();
+        auto it = holds.find(id);
+        if (it == holds.end()) return false;
+        holdWheel.cancel(it->second.timer);
+        SeatHold h = takeHold(it);
+        if (addPassenger(h.id, h.name, h.row, h.col, h.flightClass)) return true;
+        fillFreedSeat(h.row, h.col);
+        return false;
+    }
+
+    // Function: Give a held seat back early (goes to the waitlist first)
+    bool releaseHold(const string& id) override {
+        auto it = holds.find(id);
+        if (it == holds.end()) return false;
+        holdWheel.cancel(it->second.timer);
+        SeatHold h = takeHold(it);
+        Log::info() << ">> [Hold] Hold on " << h.row << h.col << " released.";
+        fillFreedSeat(h.row, h.col);
+        return true;
+    }
+
+    int expireHolds() override { return expireHoldsAt(holdClock()); }
+
+    // Function: Advance the wheel to 'tick' and free every hold due by then.
+    // Each expired seat goes straight into waitlist promotion.
+    int expireHoldsAt(long long tick) {
+        return holdWheel.advance(tick, [this](const string& id) {
+            auto it = holds.find(id);
+            if (it == holds.end()) return;
+            SeatHold h = takeHold(it);
+            Log::info() << ">> [Hold] Hold on " << h.row << h.col << " for " << h.name << " expired.";
+            fillFreedSeat(h.row, h.col);
+        });
+    }
+
+    int holdCount() const { return (int)holds.size(); }
+
+    // Benchmark switch: ticks move only through expireHoldsAt() (no wall clock)
+    void setManualHoldClock(bool on) { manualHoldClock = on; }
+
+    bool flightStats(FlightStats& stats) override {
+        fillSeatStats(stats, occupancy, heldByZone);
+        waitTally.fill(stats);
+        return true;
+    }
+
+    shared_ptr<const SeatSnapshot> snapshot() const override { return snapshots.current(); }
+
+    const ChangeFeed* changeFeed() const override { return &feed; }
+    void setChangeFeed(bool on) { feed.setEnabled(on); } // Benchmark switch
+
+    // Benchmark switch: true = tombstones + batched compaction (default),
+    // false = shift every later passenger left on each removal
+    void setTombstoneDeletes(bool on) {
+        compactPassengerList();
+        tombstoneDeletes = on;
+    }
+
+    // Opt-in switch: true = searchPassenger finds seated IDs through the
+    // slotByID index (O(1)) instead of the linear key scan. Off by default,
+    // so the scan comparison between the systems stays fair.
+    void setIndexedSearch(bool on) { indexedSearch = on; }
+
+    // Benchmark switch: threads for the searchPassenger scan (1 = off).
+    // Flights under PARALLEL_SCAN_MIN slots always scan on one thread.
+    void setScanThreads(int threads) {
+        delete scanPool;
+        scanPool = nullptr;
+        scanThreads = threads < 1 ? 1 : threads;
+    }
+    static int parallelScanMin() { return PARALLEL_SCAN_MIN; }
+
+    // ==========================================
+    // FEATURE: Range Queries (Row Buckets)
+    // ==========================================
+    vector<Passenger*> queryPassengers(int fromRow, int toRow, int cls, int col) override {
+        return buckets.query(fromRow, toRow, cls, col);
+    }
+
+    // ==========================================
+    // FEATURE: Name Search (Prefix / Fuzzy Index)
+    // ==========================================
+    vector<NameMatch> searchByName(const string& query, int k) override {
+        return nameIndex.search(query, k > 0 ? (size_t)k : 0);
+    }
+
+    // ==========================================
+    // HELPER: Batch Waitlist Pass (Priority Mode)
+    // Drops every waitlist entry of a listed ID, then fills the freed seats
+    // class by class (First -> Business -> Economy) from the class heaps.
+    // A waiter whose booking fails stays in line and the seat goes to the
+    // next waiter. Returns the promotions.
+    // ==========================================
+    int cancelAndPromoteByPriority(const unordered_set<string>& targets, vector<pair<int, string>>* freedSeats, int& removed) {
+        for (const string& id : targets) {
+            for (WaitlistEntry* w = waitlist.find(id); w != nullptr; w = waitlist.find(id)) {
+                nameIndex.remove(id, true);
+                feed.publish(CHANGE_WAIT_LEAVE, w->id, w->name, w->row, w->col, w->flightClass);
+                removeWaiter(w->seq);
+                removed++;
+            }
+        }
+
+        int promoted = 0;
+        for (int cls = 0; cls < CLASS_COUNT; cls++) {
+            vector<long long> stay; // Failed bookings, back into the heap afterwards
+            while (!freedSeats[cls].empty() && !waitHeaps[cls].empty()) {
+                pair<int, string> seat = freedSeats[cls].back(); // Used up only by a booking
+                long long seq = waitHeaps[cls].top();
+                waitHeaps[cls].pop();
+                WaitlistEntry e = *waitlist.at(seq); // addPassenger may grow the ring
+                nameIndex.remove(e.id, true); // Re-indexed as seated by addPassenger
+                if (addPassenger(e.id, e.name, seat.first, seat.second, e.flightClass)) {
+                    freedSeats[cls].pop_back();
+                    waitTally.leave(e.flightClass);
+                    feed.publish(CHANGE_PROMOTE, e.id, e.name, seat.first, seat.second, e.flightClass);
+                    waitlist.removeAt(seq);
+                    promoted++;
+                } else {
+                    nameIndex.add(e.id, e.name, true);
+                    stay.push_back(seq);
+                }
+            }
+            for (long long seq : stay) waitHeaps[cls].push(seq, waitlist.at(seq)->priority, seq);
+        }
+        return promoted;
+    }
+
+    // ==========================================
+    // FEATURE: Batch Cancellation
+    // 1. Seated IDs: ID index -> tombstone (no compaction inside the batch).
+    // 2. One pass over the waitlist: drop cancelled IDs, and seat waiting
+    //    passengers (queue order) in freed seats of their own class.
+    // 3. Compact once at the end if the tombstone threshold was crossed.
+    // Cost: O(K + W) instead of K separate removals and promotions.
+    // ==========================================
+    int removePassengers(const vector<string>& ids) override {
+        unordered_set<string> targets(ids.begin(), ids.end());
+        vector<pair<int, string>> freedSeats[CLASS_COUNT]; // (row, col) per class
+        int removed = 0;
+
+        // 1. Seated passengers
+        for (const string& id : targets) {
+            auto found = slotByID.find(id);
+            if (found == slotByID.end()) continue;
+            int slot = found->second;
+            slotByID.erase(found);
+
+            Passenger* p = passengerList[slot];
+            int cls = classCode(p->flightClass);
+            if (cls != CLASS_NONE) freedSeats[cls].push_back(make_pair(p->seatRow, p->seatCol));
+            vacateSeat(p->seatRow, p->seatCol);
+            nameIndex.remove(id, false);
+            feed.publish(CHANGE_SEAT_REMOVE, id, p->name, p->seatRow, p->seatCol, p->flightClass);
+            delete p;
+            passengerList[slot] = nullptr;
+            idKeys[slot] = 0;
+            freeSlots.push_back(slot);
+            currentCount--;
+            removed++;
+        }
+        int waitlistTargets = (int)targets.size() - removed;
+        int freedLeft = removed;
+
+        // 2. Waitlist: cancel + promote in one pass (stops once nothing is left to do)
+        int promoted = 0;
+        if (priorityMode) {
+            promoted = cancelAndPromoteByPriority(targets, freedSeats, removed);
+            freedLeft = waitlistTargets = 0; // Skips the FIFO pass below
+        }
+        for (long long s = waitlist.firstSeq(); s < waitlist.endSeq() && (waitlistTargets > 0 || freedLeft > 0); s++) {
+            WaitlistEntry* w = waitlist.at(s);
+            if (w == nullptr) continue; // Tombstone
+            bool unlink = false;
+
+            if (targets.count(w->id)) {
+                nameIndex.remove(w->id, true);
+                feed.publish(CHANGE_WAIT_LEAVE, w->id, w->name, w->row, w->col, w->flightClass);
+                unlink = true;
+                waitlistTargets--;
+                removed++;
+            } else {
+                int cls = classCode(w->flightClass);
+                if (cls != CLASS_NONE && !freedSeats[cls].empty()) {
+                    pair<int, string> seat = freedSeats[cls].back(); // Used up only by a booking
+                    WaitlistEntry e = *w; // addPassenger may grow the ring
+                    nameIndex.remove(e.id, true); // Re-indexed as seated by addPassenger
+                    if (addPassenger(e.id, e.name, seat.first, seat.second, e.flightClass)) {
+                        freedSeats[cls].pop_back();
+                        freedLeft--;
+                        feed.publish(CHANGE_PROMOTE, e.id, e.name, seat.first, seat.second, e.flightClass);
+                        promoted++;
+                        unlink = true;
+                    } else {
+                        nameIndex.add(e.id, e.name, true); // Stays in line
+                    }
+                }
+            }
+
+            if (unlink) {
+                waitTally.leave(waitlist.at(s)->flightClass); // Re-read: addPassenger may have grown the ring
+                waitlist.removeAt(s);
+            }
+        }
+        compactWaitlist();
+
+        // 3. One compaction for the whole batch
+        if (!tombstoneDeletes || (tombstoneCount() >= MIN_TOMBSTONES_TO_COMPACT && tombstoneCount() * 4 > slotCount)) {
+            compactPassengerList();
+        }
+
+        cout << ">> [Batch] Cancelled " << removed << " of " << ids.size() << " IDs, "
+             << promoted << " promoted from Waitlist." << endl;
+        return removed;
+    }
+
+    // ==========================================
+    // FEATURE: Batch Lookup
+    // Seated IDs through the ID index, the rest through the waitlist's ID map.
+    // ==========================================
+    vector<Passenger*> searchPassengers(const vector<string>& ids) override {
+        vector<Passenger*> result(ids.size(), nullptr);
+        unordered_map<string, vector<int>> pending; // ID -> positions in 'ids'
+
+        for (int i = 0; i < (int)ids.size(); i++) {
+            auto found = slotByID.find(ids[i]);
+            if (found != slotByID.end()) result[i] = passengerList[found->second];
+            else pending[ids[i]].push_back(i);
+        }
+
+        batchWaitlistHits.clear();
+        batchWaitlistHits.reserve(pending.size()); // No reallocation: result pointers stay valid
+        for (auto found = pending.begin(); found != pending.end(); ++found) {
+            WaitlistEntry* w = waitlist.find(found->first);
+            if (w == nullptr) continue;
+
+            batchWaitlistHits.push_back(waitlistRecord(w->id, w->name, w->flightClass));
+            for (int i : found->second) result[i] = &batchWaitlistHits.back();
+        }
+        return result;
     }
 
     // ==========================================
@@ -518,8 +1092,10 @@ public:
             return;
         }
         cout << ">> [Array] Sorting by ID using MERGE SORT..." << endl;
-        
+        compactPassengerList(); // Sorts work on a dense array
+
         mergeSortRecursive(passengerList, 0, currentCount - 1);
+        reindexSlots();
         
         cout << ">> Sort Complete (Merge Sort)." << endl;
         displayManifest();
@@ -0,0 +1,1450 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+#include "FlightCommon.hpp"
+#include "Timer.hpp"
+#include "StaticFlight.hpp"
+#include "NameIndex.hpp"
+#include "IDScan.hpp"
+#include "ScanPool.hpp"
+#include "DataLoader.hpp"
+#include "CsvFollower.hpp"
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+// Include System Implementations
+#include "ArraySystem.cpp"
+#include "LinkedListSystem.cpp"
+#include "UnrolledListSystem.cpp"
+#include "SkipListSystem.cpp"
+
+using namespace std;
+
+// ==========================================
+// TOOL: Benchmark Harness
+// Description: Non-interactive performance suites for the flight systems.
+// Each suite builds its own synthetic data in memory so results do not
+// depend on the CSV on disk. System console output is discarded while a
+// measurement runs so the numbers reflect the data structures, not the
+// terminal.
+//
+// Build: g++ -std=c++17 -O2 -pthread Benchmark.cpp -o bench
+// Usage: bench [suite ...] [--records N] [--repeat N]
+//        (no suite = run all)
+// ==========================================
+
+struct BenchConfig {
+    int records = 200000;   // Rows fed into each system
+    int queries = 1000000;  // Lookups per search measurement
+    int repeat = 5;         // Best-of-N timing
+};
+
+struct BenchRecord {
+    string id;
+    string name;
+    int row;
+    string col;
+    string fclass;
+};
+
+// ==========================================
+// HELPER: Silence System Output
+// Swaps cout's buffer for one that drops everything and turns the
+// logger off (status lines are not even formatted).
+// ==========================================
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+class QuietScope {
+    NullBuffer sink;
+    streambuf* saved;
+    int savedLevel;
+public:
+    QuietScope() {
+        saved = cout.rdbuf(&sink);
+        savedLevel = Log::logger().level();
+        Log::logger().setLevel(Log::OFF);
+    }
+    ~QuietScope() {
+        cout.rdbuf(saved);
+        Log::logger().setLevel(savedLevel);
+    }
+};
+
+// ==========================================
+// HELPER: Synthetic Records
+// Same shape as the CSV: class always matches the row zone.
+// ==========================================
+vector<BenchRecord> makeRecords(int count, int rows, unsigned seed) {
+    static const char* FIRST[] = { "Alice", "Bob", "Carol", "David", "Eve", "Frank", "Grace", "Henry" };
+    static const char* LAST[] = { "Smith", "Jones", "Brown", "Taylor", "Wilson", "Davis", "Miller" };
+
+    mt19937 rng(seed);
+    uniform_int_distribution<int> pickRow(1, rows);
+    uniform_int_distribution<int> pickCol(0, FlightGlobal::cols() - 1);
+    vector<BenchRecord> out;
+    out.reserve(count);
+    for (int i = 0; i < count; i++) {
+        BenchRecord r;
+        r.id = to_string(100000 + i);
+        r.name = string(FIRST[rng() % 8]) + " " + LAST[rng() % 7];
+        r.row = pickRow(rng);
+        r.col = FlightGlobal::getColName(pickCol(rng));
+        r.fclass = className(FlightGlobal::layout().classOfRow(r.row));
+        out.push_back(r);
+    }
+    return out;
+}
+
+// ==========================================
+// HELPER: Large Cabin
+// All-Economy layout with enough rows to seat 'n' passengers; the previous
+// layout is restored when the scope ends. seatedRecords() fills it in order.
+// ==========================================
+class BenchCabin {
+    AircraftLayout saved;
+public:
+    explicit BenchCabin(int n) {
+        saved = FlightGlobal::layout();
+        AircraftLayout big;
+        big.name = "Bench cabin";
+        big.totalRows = (n + big.cols - 1) / big.cols;
+        big.classStart[CLASS_FIRST] = 1;    big.classEnd[CLASS_FIRST] = 0;
+        big.classStart[CLASS_BUSINESS] = 1; big.classEnd[CLASS_BUSINESS] = 0;
+        big.classStart[CLASS_ECONOMY] = 1;  big.classEnd[CLASS_ECONOMY] = big.totalRows;
+        big.rebuild();
+        FlightGlobal::setLayout(big);
+    }
+    ~BenchCabin() { FlightGlobal::setLayout(saved); }
+};
+
+vector<BenchRecord> seatedRecords(int n) {
+    vector<BenchRecord> recs;
+    recs.reserve(n);
+    for (int i = 0; i < n; i++) {
+        BenchRecord r;
+        r.id = to_string(100000 + i);
+        r.name = "Passenger " + r.id;
+        r.row = i / FlightGlobal::cols() + 1;
+        r.col = FlightGlobal::getColName(i % FlightGlobal::cols());
+        r.fclass = "Economy";
+        recs.push_back(r);
+    }
+    return recs;
+}
+
+// Keeps results alive so the optimizer cannot drop the measured work
+volatile long long benchSink = 0;
+
+void printResult(const string& label, long long ops, long long micros) {
+    double nsPerOp = micros * 1000.0 / (ops > 0 ? ops : 1);
+    cout << "  " << left << setw(44) << label
+         << right << setw(10) << micros << " us"
+         << setw(12) << fixed << setprecision(1) << nsPerOp << " ns/op" << endl;
+}
+
+// ==========================================
+// SUITE: Virtual vs Static Dispatch
+// Same records, same system, only the call path changes:
+//   virtual -> FlightSystem* (vtable lookup, no inlining across the call)
+//   static  -> StaticFlight<System> (qualified call, inlinable)
+// ==========================================
+
+// Hides the dynamic type from the optimizer so the virtual path is really virtual
+__attribute__((noinline)) FlightSystem* asInterface(FlightSystem* sys) { return sys; }
+
+template <typename System>
+long long timeIngest(const vector<BenchRecord>& recs, bool useVirtual) {
+    QuietScope quiet;
+    System sys;
+    Timer t;
+    {
+        t.start();
+        if (useVirtual) {
+            FlightSystem* v = asInterface(&sys);
+            for (const BenchRecord& r : recs) v->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+        } else {
+            StaticFlight<System> s(sys);
+            for (const BenchRecord& r : recs) s.addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+        }
+        t.stop();
+    }
+    return t.getDurationInMicroseconds();
+}
+
+template <typename System>
+long long timeSearch(System& sys, const vector<string>& keys, int queries, bool useVirtual) {
+    long long found = 0;
+    Timer t;
+    t.start();
+    if (useVirtual) {
+        FlightSystem* v = asInterface(&sys);
+        for (int i = 0; i < queries; i++) found += (v->searchPassenger(keys[i % keys.size()]) != nullptr);
+    } else {
+        StaticFlight<System> s(sys);
+        for (int i = 0; i < queries; i++) found += (s.searchPassenger(keys[i % keys.size()]) != nullptr);
+    }
+    t.stop();
+    benchSink += found;
+    return t.getDurationInMicroseconds();
+}
+
+template <typename System>
+void runDispatchFor(const string& systemName, const BenchConfig& cfg) {
+    vector<BenchRecord> recs = makeRecords(cfg.records, FlightGlobal::totalRows(), 7);
+
+    long long bestVirtual = -1, bestStatic = -1;
+    for (int i = 0; i < cfg.repeat; i++) {
+        long long v = timeIngest<System>(recs, true);
+        long long s = timeIngest<System>(recs, false);
+        if (bestVirtual < 0 || v < bestVirtual) bestVirtual = v;
+        if (bestStatic < 0 || s < bestStatic) bestStatic = s;
+    }
+    cout << systemName << " - ingest " << recs.size() << " records (best of " << cfg.repeat << ")" << endl;
+    printResult("virtual  FlightSystem*", (long long)recs.size(), bestVirtual);
+    printResult("static   StaticFlight<" + systemName + ">", (long long)recs.size(), bestStatic);
+
+    // Search: seated passengers only (short scans, where call overhead matters most)
+    System* sys;
+    vector<string> keys;
+    {
+        QuietScope quiet;
+        sys = new System();
+        for (int i = 0; i < 2000 && i < (int)recs.size(); i++) {
+            const BenchRecord& r = recs[i];
+            if (sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass)) keys.push_back(r.id);
+        }
+        if (keys.empty()) { delete sys; return; }
+    }
+
+    bestVirtual = -1; bestStatic = -1;
+    for (int i = 0; i < cfg.repeat; i++) {
+        long long v = timeSearch(*sys, keys, cfg.queries, true);
+        long long s = timeSearch(*sys, keys, cfg.queries, false);
+        if (bestVirtual < 0 || v < bestVirtual) bestVirtual = v;
+        if (bestStatic < 0 || s < bestStatic) bestStatic = s;
+    }
+    cout << systemName << " - search " << cfg.queries << " hits over " << keys.size() << " seated (best of " << cfg.repeat << ")" << endl;
+    printResult("virtual  FlightSystem*", cfg.queries, bestVirtual);
+    printResult("static   StaticFlight<" + systemName + ">", cfg.queries, bestStatic);
+
+    QuietScope quiet;
+    delete sys;
+}
+
+void suiteDispatch(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: dispatch (virtual vs static) ===" << endl;
+    runDispatchFor<ArraySystem>("ArraySystem", cfg);
+    runDispatchFor<LinkedListSystem>("LinkedListSystem", cfg);
+    runDispatchFor<UnrolledListSystem>("UnrolledListSystem", cfg);
+    runDispatchFor<SkipListSystem>("SkipListSystem", cfg);
+}
+
+// ==========================================
+// SUITE: Name Index (prefix + fuzzy)
+// Millions of distinct synthetic names, then average query latency.
+// ==========================================
+string syllableName(mt19937& rng) {
+    static const char* SYL[] = { "an", "ber", "car", "da", "el", "fi", "gor", "ha", "in", "jo",
+                                 "ka", "li", "mar", "no", "ol", "pe", "qui", "ro", "sa", "ti",
+                                 "ul", "va", "wen", "xi", "yu", "zo" };
+    string out;
+    for (int word = 0; word < 2; word++) {
+        if (word) out += ' ';
+        int parts = 2 + rng() % 2;
+        for (int p = 0; p < parts; p++) out += SYL[rng() % 26];
+        out[word ? out.find(' ') + 1 : 0] = (char)toupper(out[word ? out.find(' ') + 1 : 0]);
+    }
+    return out;
+}
+
+// Drop or swap one letter to imitate a typo
+string misspell(string s, mt19937& rng) {
+    size_t i = 1 + rng() % (s.size() - 2);
+    if (rng() % 2) s.erase(i, 1);
+    else swap(s[i], s[i + 1]);
+    return s;
+}
+
+void suiteNames(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: names (prefix / fuzzy index) ===" << endl;
+    int n = cfg.records * 10; // Name index is cheap to fill; use a bigger population
+    mt19937 rng(11);
+    vector<string> population;
+    population.reserve(n);
+    for (int i = 0; i < n; i++) population.push_back(syllableName(rng));
+
+    NameIndex index;
+    Timer t;
+    t.start();
+    for (int i = 0; i < n; i++) index.add(to_string(100000 + i), population[i], i % 10 == 0);
+    t.stop();
+    cout << "Indexed " << n << " passengers (" << index.distinctNames() << " distinct names)" << endl;
+    printResult("build", n, t.getDurationInMicroseconds());
+
+    int queries = 2000;
+    vector<string> prefixQ, fuzzyQ;
+    for (int i = 0; i < queries; i++) {
+        const string& name = population[rng() % n];
+        prefixQ.push_back(name.substr(0, 3 + rng() % 4));
+        fuzzyQ.push_back(misspell(name, rng));
+    }
+
+    long long hits = 0;
+    t.start();
+    for (const string& q : prefixQ) hits += index.searchPrefix(q, 10).size();
+    t.stop();
+    printResult("prefix top-10", queries, t.getDurationInMicroseconds());
+
+    t.start();
+    for (const string& q : fuzzyQ) hits += index.searchFuzzy(q, 10).size();
+    t.stop();
+    printResult("fuzzy top-10", queries, t.getDurationInMicroseconds());
+
+    t.start();
+    for (int i = 0; i < n; i += 2) index.remove(to_string(100000 + i), i % 10 == 0);
+    t.stop();
+    printResult("remove (half)", n / 2, t.getDurationInMicroseconds());
+    benchSink += hits;
+}
+
+// ==========================================
+// SUITE: Bulk Cancellation
+// A flight change cancels half the passengers in random order.
+//   shift     -> every removal shifts the rest of passengerList left
+//   tombstone -> removal leaves a nullptr, compaction runs in batches
+//   batch     -> removePassengers: one pass / one compaction for all IDs
+// Both variants find the slot through the ID index; shifting also has to
+// re-point the index entry of every passenger it moves.
+// ==========================================
+template <typename System>
+long long timeBulkCancel(const vector<BenchRecord>& recs, const vector<string>& cancel, bool batch, bool tombstones = true) {
+    QuietScope quiet;
+    System* sys = new System();
+    if constexpr (is_same<System, ArraySystem>::value) sys->setTombstoneDeletes(tombstones);
+    for (const BenchRecord& r : recs) sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+
+    Timer t;
+    t.start();
+    long long removed = 0;
+    if (batch) removed = sys->removePassengers(cancel);
+    else for (const string& id : cancel) removed += sys->removePassenger(id);
+    t.stop();
+    benchSink += removed;
+    delete sys;
+    return t.getDurationInMicroseconds();
+}
+
+// Per-ID removal vs one batch for the list-based systems
+template <typename System>
+void runListCancel(const string& systemName, const vector<BenchRecord>& recs, const vector<string>& cancel, const BenchConfig& cfg) {
+    long long single = timeBulkCancel<System>(recs, cancel, false);
+    long long batch = -1;
+    for (int i = 0; i < cfg.repeat; i++) {
+        long long b = timeBulkCancel<System>(recs, cancel, true);
+        if (batch < 0 || b < batch) batch = b;
+    }
+    cout << systemName << " - cancel " << cancel.size() << " of " << recs.size() << " passengers (per ID: 1 run, batch: best of " << cfg.repeat << ")" << endl;
+    printResult("removePassenger per ID", (long long)cancel.size(), single);
+    printResult("removePassengers (one pass)", (long long)cancel.size(), batch);
+}
+
+void suiteCancel(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: cancel (shift / tombstone / batch) ===" << endl;
+    int n = cfg.records < 20000 ? cfg.records : 20000; // Shifting is O(N^2) overall
+
+    BenchCabin cabin(n); // Big enough to seat everyone
+    vector<BenchRecord> recs = seatedRecords(n);
+    vector<string> cancel;
+    for (int i = 0; i < n; i += 2) cancel.push_back(recs[i].id);
+    shuffle(cancel.begin(), cancel.end(), mt19937(5));
+
+    // Shifting runs for seconds at this size: time it once
+    long long shiftTime = timeBulkCancel<ArraySystem>(recs, cancel, false, false);
+    long long bestTomb = -1, bestBatch = -1;
+    for (int i = 0; i < cfg.repeat; i++) {
+        long long a = timeBulkCancel<ArraySystem>(recs, cancel, false);
+        long long b = timeBulkCancel<ArraySystem>(recs, cancel, true);
+        if (bestTomb < 0 || a < bestTomb) bestTomb = a;
+        if (bestBatch < 0 || b < bestBatch) bestBatch = b;
+    }
+    cout << "ArraySystem - cancel " << cancel.size() << " of " << n << " passengers (shift: 1 run, others: best of " << cfg.repeat << ")" << endl;
+    printResult("shift left per removal", (long long)cancel.size(), shiftTime);
+    printResult("tombstone + batched compaction", (long long)cancel.size(), bestTomb);
+    printResult("removePassengers (one batch)", (long long)cancel.size(), bestBatch);
+
+    runListCancel<LinkedListSystem>("LinkedListSystem", recs, cancel, cfg);
+    runListCancel<UnrolledListSystem>("UnrolledListSystem", recs, cancel, cfg);
+    runListCancel<SkipListSystem>("SkipListSystem", recs, cancel, cfg);
+}
+
+// ==========================================
+// SUITE: Linear Scan Bandwidth
+// Same seated population in every system; searchPassenger for random
+// seated IDs (average scan = half the list). Shows pointer chasing per
+// passenger (linked list) against blocks of 32 records (unrolled list).
+// ==========================================
+template <typename System>
+void runScanFor(const string& systemName, const vector<BenchRecord>& recs, const vector<string>& keys, const BenchConfig& cfg) {
+    System* sys;
+    {
+        QuietScope quiet;
+        sys = new System();
+        for (const BenchRecord& r : recs) sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+    }
+
+    long long best = -1;
+    for (int rep = 0; rep < cfg.repeat; rep++) {
+        long long found = 0;
+        Timer t;
+        t.start();
+        for (const string& k : keys) found += (sys->searchPassenger(k) != nullptr);
+        t.stop();
+        benchSink += found;
+        if (best < 0 || t.getDurationInMicroseconds() < best) best = t.getDurationInMicroseconds();
+    }
+    double perRecord = best * 1000.0 / ((double)keys.size() * recs.size() / 2);
+    printResult(systemName + " searchPassenger", (long long)keys.size(), best);
+    cout << "  " << left << setw(44) << "  -> per record scanned" << right << setw(25) << fixed << setprecision(2) << perRecord << " ns" << endl;
+
+    QuietScope quiet;
+    delete sys;
+}
+
+void suiteScan(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: scan (array / linked list / unrolled list / skip list) ===" << endl;
+    int n = cfg.records < 50000 ? cfg.records : 50000;
+    BenchCabin cabin(n);
+    vector<BenchRecord> recs = seatedRecords(n);
+
+    mt19937 rng(9);
+    vector<string> keys;
+    for (int i = 0; i < 2000; i++) keys.push_back(recs[rng() % n].id);
+
+    cout << n << " seated, " << keys.size() << " random hits (best of " << cfg.repeat << ")" << endl;
+    runScanFor<ArraySystem>("ArraySystem", recs, keys, cfg);
+    runScanFor<LinkedListSystem>("LinkedListSystem", recs, keys, cfg);
+    runScanFor<UnrolledListSystem>("UnrolledListSystem", recs, keys, cfg);
+    runScanFor<SkipListSystem>("SkipListSystem", recs, keys, cfg);
+}
+
+// ==========================================
+// SUITE: Skewed Lookups (Zipf)
+// Lookup IDs follow a Zipf distribution (s = 0.99) over the seated
+// passengers; the popular ones are spread randomly through the list.
+// Compares the linked list's fixed order with move-to-front, transpose
+// and the hot-ID cache. Each variant starts from a fresh list, so the
+// time includes the warm-up while the list reorganizes.
+// ==========================================
+vector<int> zipfRanks(int n, int count, double s, unsigned seed) {
+    vector<double> cdf(n);
+    double total = 0;
+    for (int k = 0; k < n; k++) {
+        total += 1.0 / pow(k + 1, s);
+        cdf[k] = total;
+    }
+    mt19937 rng(seed);
+    uniform_real_distribution<double> pick(0.0, total);
+    vector<int> out;
+    out.reserve(count);
+    for (int i = 0; i < count; i++) {
+        int k = (int)(lower_bound(cdf.begin(), cdf.end(), pick(rng)) - cdf.begin());
+        out.push_back(k < n ? k : n - 1);
+    }
+    return out;
+}
+
+long long timeZipfLookups(const vector<BenchRecord>& recs, const vector<string>& keys, int order, bool cache) {
+    LinkedListSystem* sys;
+    {
+        QuietScope quiet;
+        sys = new LinkedListSystem();
+        for (const BenchRecord& r : recs) sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+    }
+    sys->setSearchOrder(order);
+    sys->setHotCache(cache);
+
+    long long found = 0;
+    Timer t;
+    t.start();
+    for (const string& k : keys) found += (sys->searchPassenger(k) != nullptr);
+    t.stop();
+    benchSink += found;
+
+    QuietScope quiet;
+    delete sys;
+    return t.getDurationInMicroseconds();
+}
+
+void suiteZipf(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: zipf (linked list self-organizing search) ===" << endl;
+    int n = cfg.records < 10000 ? cfg.records : 10000;
+    int q = cfg.queries < 20000 ? cfg.queries : 20000; // Fixed order scans ~n/2 per lookup
+    BenchCabin cabin(n);
+    vector<BenchRecord> recs = seatedRecords(n);
+
+    // Rank k -> a random passenger, so popularity has nothing to do with list position
+    vector<int> byRank(n);
+    for (int i = 0; i < n; i++) byRank[i] = i;
+    shuffle(byRank.begin(), byRank.end(), mt19937(11));
+
+    vector<string> keys;
+    keys.reserve(q);
+    for (int k : zipfRanks(n, q, 0.99, 13)) keys.push_back(recs[byRank[k]].id);
+
+    cout << "LinkedListSystem - " << n << " seated, " << q << " Zipf(0.99) lookups (1 run each, fresh list)" << endl;
+    printResult("fixed order", q, timeZipfLookups(recs, keys, SEARCH_FIXED, false));
+    printResult("transpose", q, timeZipfLookups(recs, keys, SEARCH_TRANSPOSE, false));
+    printResult("move-to-front", q, timeZipfLookups(recs, keys, SEARCH_MOVE_TO_FRONT, false));
+    printResult("hot-ID cache (64 slots)", q, timeZipfLookups(recs, keys, SEARCH_FIXED, true));
+    printResult("move-to-front + hot-ID cache", q, timeZipfLookups(recs, keys, SEARCH_MOVE_TO_FRONT, true));
+}
+
+// ==========================================
+// SUITE: Negative Lookups (Bloom Filter)
+// Searches for IDs that are not on the flight, and bookings with new IDs,
+// on the list-based systems with the counting Bloom filter on and off.
+// Without the filter each one walks every passenger (and the waitlist).
+// ==========================================
+template <typename System>
+void runBloomFor(const string& systemName, const vector<BenchRecord>& seated, const vector<BenchRecord>& fresh, const BenchConfig& cfg) {
+    cout << systemName << " - " << seated.size() << " seated, " << fresh.size() << " unknown IDs (best of " << cfg.repeat << ")" << endl;
+    for (int on = 1; on >= 0; on--) {
+        long long bestSearch = -1, bestAdd = -1;
+        const CountingBloomFilter* f = nullptr;
+        System* sys = nullptr;
+        for (int rep = 0; rep < cfg.repeat; rep++) {
+            {
+                QuietScope quiet;
+                delete sys;
+                sys = new System();
+                sys->setIDFilter(on == 1);
+                for (const BenchRecord& r : seated) sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+            }
+            long long found = 0;
+            Timer t;
+            t.start();
+            for (const BenchRecord& r : fresh) found += (sys->searchPassenger(r.id) != nullptr);
+            t.stop();
+            if (bestSearch < 0 || t.getDurationInMicroseconds() < bestSearch) bestSearch = t.getDurationInMicroseconds();
+
+            Timer a;
+            a.start();
+            for (const BenchRecord& r : fresh) found += sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+            a.stop();
+            if (bestAdd < 0 || a.getDurationInMicroseconds() < bestAdd) bestAdd = a.getDurationInMicroseconds();
+            benchSink += found;
+        }
+        string mode = on ? "filter on " : "filter off";
+        printResult(mode + ": searchPassenger (miss)", (long long)fresh.size(), bestSearch);
+        printResult(mode + ": addPassenger (new ID)", (long long)fresh.size(), bestAdd);
+        f = sys->idFilter();
+        if (f != nullptr) {
+            cout << "    " << f->size() << " IDs, " << f->memoryBytes() << " bytes ("
+                 << fixed << setprecision(1) << (double)f->memoryBytes() / f->size() << " per ID), false positives "
+                 << setprecision(2) << f->observedFPR() * 100 << "% measured / " << f->expectedFPR() * 100 << "% expected" << endl;
+        }
+        QuietScope quiet;
+        delete sys;
+    }
+}
+
+void suiteBloom(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: bloom (negative ID lookups) ===" << endl;
+    int n = cfg.records < 20000 ? cfg.records : 20000;
+    int q = 2000;
+    BenchCabin cabin(n + q);
+    vector<BenchRecord> all = seatedRecords(n + q);
+    vector<BenchRecord> seated(all.begin(), all.begin() + n);
+    vector<BenchRecord> fresh(all.begin() + n, all.end()); // New IDs on free seats
+
+    runBloomFor<LinkedListSystem>("LinkedListSystem", seated, fresh, cfg);
+    runBloomFor<UnrolledListSystem>("UnrolledListSystem", seated, fresh, cfg);
+}
+
+// ==========================================
+// SUITE: SIMD ID Scan
+// 1. Raw kernels over a dense array of packed 8-byte ID keys, against a
+//    string-compare scan over Passenger* (the old ArraySystem loop).
+// 2. ArraySystem::searchPassenger with each kernel forced.
+// Random seated IDs, so each lookup reads half the array on average.
+// ==========================================
+void suiteSimd(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: simd (linear ID scan kernels) ===" << endl;
+    int n = cfg.records;
+    vector<BenchRecord> recs = seatedRecords(n);
+    vector<uint64_t> keys(n);
+    vector<Passenger> people(n);
+    vector<Passenger*> ptrs(n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = IDScan::pack(recs[i].id);
+        people[i].passengerID = recs[i].id;
+        ptrs[i] = &people[i];
+    }
+    shuffle(ptrs.begin(), ptrs.end(), mt19937(17)); // Records scattered like heap allocations
+
+    mt19937 rng(19);
+    vector<int> targets;
+    for (int i = 0; i < 2000; i++) targets.push_back(rng() % n);
+    double bytesPerLookup = 8.0 * n / 2;
+
+    cout << n << " IDs, " << targets.size() << " random hits (best of " << cfg.repeat << "), default kernel: "
+         << IDScan::kernelName(IDScan::activeKernel()) << endl;
+    auto report = [&](const string& label, long long best) {
+        printResult(label, (long long)targets.size(), best);
+        double nsPerKey = best * 1000.0 / (targets.size() * (n / 2.0));
+        cout << "  " << left << setw(44) << "  -> per ID scanned" << right << setw(25) << fixed << setprecision(3) << nsPerKey << " ns";
+        if (label.find("string") == string::npos) cout << "  (" << setprecision(1) << bytesPerLookup * targets.size() / (best * 1000.0) << " GB/s)";
+        cout << endl;
+    };
+
+    long long best = -1;
+    for (int rep = 0; rep < cfg.repeat; rep++) {
+        long long found = 0;
+        Timer t;
+        t.start();
+        for (int target : targets) {
+            const string& id = people[target].passengerID;
+            for (int i = 0; i < n; i++) {
+                if (ptrs[i]->passengerID == id) { found += i; break; }
+            }
+        }
+        t.stop();
+        benchSink += found;
+        if (best < 0 || t.getDurationInMicroseconds() < best) best = t.getDurationInMicroseconds();
+    }
+    report("string compare via Passenger*", best);
+
+    int savedKernel = IDScan::activeKernel();
+    for (int kernel = IDScan::SCALAR; kernel <= IDScan::AVX2; kernel++) {
+        if (!IDScan::setKernel(kernel)) {
+            cout << "  " << IDScan::kernelName(kernel) << ": not supported on this CPU" << endl;
+            continue;
+        }
+        best = -1;
+        for (int rep = 0; rep < cfg.repeat; rep++) {
+            long long found = 0;
+            Timer t;
+            t.start();
+            for (int target : targets) found += IDScan::find(keys.data(), n, keys[target]);
+            t.stop();
+            benchSink += found;
+            if (best < 0 || t.getDurationInMicroseconds() < best) best = t.getDurationInMicroseconds();
+        }
+        report(string("packed keys, ") + IDScan::kernelName(kernel) + " kernel", best);
+    }
+
+    // Whole system: the kernel inside ArraySystem::searchPassenger
+    int m = n < 50000 ? n : 50000;
+    BenchCabin cabin(m);
+    vector<BenchRecord> seated = seatedRecords(m);
+    vector<string> lookups;
+    for (int i = 0; i < 2000; i++) lookups.push_back(seated[rng() % m].id);
+    ArraySystem* sys;
+    {
+        QuietScope quiet;
+        sys = new ArraySystem();
+        for (const BenchRecord& r : seated) sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+    }
+    cout << "ArraySystem searchPassenger - " << m << " seated, " << lookups.size() << " random hits" << endl;
+    for (int kernel = IDScan::SCALAR; kernel <= IDScan::AVX2; kernel++) {
+        if (!IDScan::setKernel(kernel)) continue;
+        best = -1;
+        for (int rep = 0; rep < cfg.repeat; rep++) {
+            long long found = 0;
+            Timer t;
+            t.start();
+            for (const string& id : lookups) found += (sys->searchPassenger(id) != nullptr);
+            t.stop();
+            benchSink += found;
+            if (best < 0 || t.getDurationInMicroseconds() < best) best = t.getDurationInMicroseconds();
+        }
+        printResult(string(IDScan::kernelName(kernel)) + " kernel", (long long)lookups.size(), best);
+    }
+    IDScan::setKernel(savedKernel);
+    QuietScope quiet;
+    delete sys;
+}
+
+// ==========================================
+// SUITE: Parallel Scan (scaling curves)
+// 1. parallelFindKey over dense key arrays of growing size, 1..T threads
+//    (T = max(4, hardware threads), at most 16).
+// 2. ArraySystem::searchPassenger above its single-thread threshold.
+// Random hit positions; "1 thread" is the plain kernel loop.
+// ==========================================
+void suiteParallel(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: parallel (multi-threaded ID scan) ===" << endl;
+    int hw = (int)thread::hardware_concurrency();
+    int maxThreads = hw > 4 ? hw : 4;
+    if (maxThreads > 16) maxThreads = 16;
+    cout << "Hardware threads: " << hw << ", kernel: " << IDScan::kernelName(IDScan::activeKernel()) << endl;
+
+    mt19937 rng(23);
+    for (int n = 1 << 16; n <= (1 << 22); n <<= 2) {
+        vector<uint64_t> keys(n);
+        for (int i = 0; i < n; i++) keys[i] = IDScan::pack(to_string(100000000 + i));
+        vector<int> targets;
+        for (int i = 0; i < 200; i++) targets.push_back(rng() % n);
+
+        cout << n << " keys (" << (n * 8 >> 10) << " KB), " << targets.size() << " random hits, best of " << cfg.repeat << endl;
+        long long single = -1;
+        for (int threads = 1; threads <= maxThreads; threads++) {
+            ScanPool pool(threads);
+            long long best = -1;
+            for (int rep = 0; rep < cfg.repeat; rep++) {
+                long long found = 0;
+                Timer t;
+                t.start();
+                for (int target : targets) {
+                    found += parallelFindKey(pool, keys.data(), n, keys[target], [](int) { return true; });
+                }
+                t.stop();
+                benchSink += found;
+                if (best < 0 || t.getDurationInMicroseconds() < best) best = t.getDurationInMicroseconds();
+            }
+            if (threads == 1) single = best;
+            printResult(to_string(threads) + " thread(s)", (long long)targets.size(), best);
+            cout << "  " << left << setw(44) << "  -> speed-up" << right << setw(25) << fixed << setprecision(2)
+                 << (best > 0 ? (double)single / best : 0.0) << " x" << endl;
+        }
+    }
+
+    // Whole system, just above the threshold
+    int m = ArraySystem::parallelScanMin() + (1 << 14);
+    BenchCabin cabin(m);
+    vector<BenchRecord> seated = seatedRecords(m);
+    ArraySystem* sys;
+    {
+        QuietScope quiet;
+        sys = new ArraySystem();
+        for (const BenchRecord& r : seated) sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+    }
+    vector<string> lookups;
+    for (int i = 0; i < 500; i++) lookups.push_back(seated[rng() % m].id);
+    cout << "ArraySystem searchPassenger - " << m << " seated (threshold " << ArraySystem::parallelScanMin() << " slots)" << endl;
+    for (int threads = 1; threads <= maxThreads; threads++) {
+        sys->setScanThreads(threads);
+        long long best = -1;
+        for (int rep = 0; rep < cfg.repeat; rep++) {
+            long long found = 0;
+            Timer t;
+            t.start();
+            for (const string& id : lookups) found += (sys->searchPassenger(id) != nullptr);
+            t.stop();
+            benchSink += found;
+            if (best < 0 || t.getDurationInMicroseconds() < best) best = t.getDurationInMicroseconds();
+        }
+        printResult(to_string(threads) + " thread(s)", (long long)lookups.size(), best);
+    }
+    QuietScope quiet;
+    delete sys;
+}
+
+// ==========================================
+// SUITE: Logging (console cost of ingest)
+// Rows on the default cabin collide almost every time, so each add emits
+// two status lines ("[System] Seat ... is taken", "[Waitlist] ... added").
+// Lines go to /dev/null:
+//   sync  -> one write + flush per line (what cout << endl did)
+//   async -> ring buffer + writer thread
+//   quiet -> level WARN, the lines are skipped
+// A real terminal only makes the sync case slower.
+// ==========================================
+void suiteLog(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: log (status lines during ingest) ===" << endl;
+    FILE* devNull = fopen("/dev/null", "w");
+    if (devNull == nullptr) {
+        cout << "Cannot open /dev/null, skipped." << endl;
+        return;
+    }
+    int n = cfg.records < 50000 ? cfg.records : 50000;
+    vector<BenchRecord> recs = makeRecords(n, FlightGlobal::totalRows(), 29);
+    Log::setOutput(devNull);
+    cout << n << " rows into ArraySystem (" << FlightGlobal::totalRows() << "-row cabin), best of " << cfg.repeat << endl;
+
+    struct Mode { const char* label; bool sync; Log::Level level; };
+    const Mode MODES[] = {
+        { "sync (flush per line)", true, Log::INFO },
+        { "async (ring buffer + writer)", false, Log::INFO },
+        { "quiet (level WARN)", false, Log::WARN },
+    };
+    for (const Mode& mode : MODES) {
+        Log::setSynchronous(mode.sync);
+        Log::setLevel(mode.level);
+        long long best = -1;
+        long long dropped = 0;
+        for (int rep = 0; rep < cfg.repeat; rep++) {
+            ArraySystem* sys;
+            {
+                QuietScope quiet;
+                sys = new ArraySystem();
+            }
+            long long before = Log::dropped();
+            Timer t;
+            t.start();
+            for (const BenchRecord& r : recs) sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+            t.stop();
+            dropped += Log::dropped() - before;
+            Log::flush();
+            if (best < 0 || t.getDurationInMicroseconds() < best) best = t.getDurationInMicroseconds();
+            QuietScope quiet;
+            delete sys;
+        }
+        printResult(mode.label, n, best);
+        if (dropped > 0) cout << "    (" << dropped << " lines dropped over " << cfg.repeat << " runs: ring buffer full)" << endl;
+    }
+
+    // Raw cost of one line on the producer side
+    Log::setSynchronous(false);
+    Log::setLevel(Log::INFO);
+    string name = "Alice Smith";
+    long long before = Log::dropped();
+    Timer t;
+    t.start();
+    for (int i = 0; i < n; i++) Log::info() << ">> [Waitlist] " << name << " added for seat " << (i % 30 + 1) << 'C' << ".";
+    t.stop();
+    long long dropped = Log::dropped() - before;
+    Log::flush();
+    printResult("Log::info() line, async", n, t.getDurationInMicroseconds());
+    if (dropped > 0) cout << "    (" << dropped << " lines dropped: ring buffer full)" << endl;
+
+    Log::setOutput(stdout);
+    fclose(devNull);
+}
+
+// ==========================================
+// SUITE: Waitlist (ring buffer vs singly linked list)
+// Every seat taken, then W more bookings for the same seats, so W
+// passengers wait in line. ArraySystem keeps the line in a ring buffer
+// with an ID map; SkipListSystem still walks a singly linked list.
+// Position queries run before and after cancelling a quarter of the line
+// (tombstones -> Fenwick tree path).
+// Auto-fill: half the seated passengers cancel one by one, each freed seat
+// refilled from the line (every 3rd waiter on standby), FIFO vs priority.
+// ==========================================
+template <typename System>
+long long timeAutoFill(const vector<BenchRecord>& seated, const vector<BenchRecord>& waiting, bool priority) {
+    System* sys;
+    {
+        QuietScope quiet;
+        sys = new System();
+        sys->setPriorityWaitlist(priority);
+        for (const BenchRecord& r : seated) sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+        for (int i = 0; i < (int)waiting.size(); i++) {
+            const BenchRecord& r = waiting[i];
+            if (i % 3 == 2) sys->addStandby(r.id, r.name, r.row, r.col, r.fclass);
+            else sys->addToWaitlist(r.id, r.name, r.row, r.col, r.fclass);
+        }
+    }
+    QuietScope quiet;
+    Timer t;
+    t.start();
+    for (int i = 0; i < (int)seated.size(); i += 2) sys->removePassenger(seated[i].id);
+    t.stop();
+    delete sys;
+    return t.getDurationInMicroseconds();
+}
+
+void suiteWaitlist(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: waitlist (ring buffer + priority waitlist) ===" << endl;
+    int n = 1000;
+    int w = cfg.records < 20000 ? cfg.records : 20000;
+    BenchCabin cabin(n);
+    vector<BenchRecord> seated = seatedRecords(n);
+    vector<BenchRecord> waiting;
+    for (int i = 0; i < w; i++) {
+        BenchRecord r = seated[i % n];
+        r.id = to_string(900000 + i);
+        waiting.push_back(r);
+    }
+    mt19937 rng(31);
+    vector<string> lookups;
+    for (int i = 0; i < 2000; i++) lookups.push_back(waiting[rng() % w].id);
+
+    ArraySystem* ring;
+    SkipListSystem* linked;
+    {
+        QuietScope quiet;
+        ring = new ArraySystem();
+        linked = new SkipListSystem();
+        for (const BenchRecord& r : seated) {
+            ring->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+            linked->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+        }
+        for (const BenchRecord& r : waiting) {
+            ring->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+            linked->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+        }
+    }
+    cout << n << " seated, " << w << " waiting, " << lookups.size() << " random waitlisted IDs" << endl;
+
+    long long found = 0;
+    Timer t;
+    t.start();
+    for (const string& id : lookups) found += (linked->searchPassenger(id) != nullptr);
+    t.stop();
+    printResult("search, linked list walk (SkipListSystem)", (long long)lookups.size(), t.getDurationInMicroseconds());
+
+    t.start();
+    for (const string& id : lookups) found += (ring->searchPassenger(id) != nullptr);
+    t.stop();
+    printResult("search, ring + ID map (ArraySystem)", (long long)lookups.size(), t.getDurationInMicroseconds());
+
+    t.start();
+    for (const string& id : lookups) found += ring->waitlistPosition(id);
+    t.stop();
+    printResult("position, no cancellations (O(1))", (long long)lookups.size(), t.getDurationInMicroseconds());
+
+    // Cancel every 4th passenger in line
+    int cancels = 0;
+    t.start();
+    for (int i = 0; i < w; i += 4) cancels += ring->cancelWaitlist(waiting[i].id);
+    t.stop();
+    printResult("cancelWaitlist (tombstone)", cancels, t.getDurationInMicroseconds());
+
+    t.start();
+    for (const string& id : lookups) found += ring->waitlistPosition(id);
+    t.stop();
+    printResult("position, 25% cancelled (Fenwick)", (long long)lookups.size(), t.getDurationInMicroseconds());
+    benchSink += found;
+    {
+        QuietScope quiet;
+        delete ring;
+        delete linked;
+    }
+
+    long long cancels2 = n / 2;
+    cout << "Cancel " << cancels2 << " seated passengers, seat refilled from the line each time" << endl;
+    printResult("ArraySystem, FIFO (ring head)", cancels2, timeAutoFill<ArraySystem>(seated, waiting, false));
+    printResult("ArraySystem, priority (class heap)", cancels2, timeAutoFill<ArraySystem>(seated, waiting, true));
+    printResult("LinkedListSystem, priority (heap + unlink walk)", cancels2, timeAutoFill<LinkedListSystem>(seated, waiting, true));
+}
+
+// ==========================================
+// SUITE: Seat Holds (hierarchical timing wheel)
+// 1. Raw wheel: 1M pending holds (TTL 1 min .. 2 h, 1 tick = 1 second),
+//    then ten minutes of one-second ticks, against a sweep that checks
+//    every pending expiry on each tick. Then run the clock out so every
+//    hold fires.
+// 2. ArraySystem: every seat held, one waiter per seat; all holds expire
+//    and each freed seat is promoted from the line.
+// ==========================================
+void suiteHolds(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: holds (timing wheel vs per-tick sweep) ===" << endl;
+    const int h = 1000000;
+    const int ticks = 600;
+    mt19937 rng(37);
+    vector<long long> expiries(h);
+    for (int i = 0; i < h; i++) expiries[i] = 60 + rng() % 7140;
+
+    TimingWheel<int> wheel;
+    long long fired = 0;
+    Timer t;
+    t.start();
+    for (int i = 0; i < h; i++) wheel.schedule(i, expiries[i]);
+    t.stop();
+    cout << h << " pending holds, " << ticks << " one-second ticks" << endl;
+    printResult("schedule (wheel)", h, t.getDurationInMicroseconds());
+
+    t.start();
+    for (int tick = 1; tick <= ticks; tick++) fired += wheel.advance(tick, [](int) {});
+    t.stop();
+    printResult("tick (wheel, incl. expiries)", ticks, t.getDurationInMicroseconds());
+
+    vector<long long> sweep = expiries;
+    t.start();
+    for (int tick = 1; tick <= ticks; tick++) {
+        for (size_t i = 0; i < sweep.size();) {
+            if (sweep[i] <= tick) {
+                sweep[i] = sweep.back(); // Expired: swap-remove
+                sweep.pop_back();
+                fired++;
+            } else i++;
+        }
+    }
+    t.stop();
+    printResult("tick (sweep all pending)", ticks, t.getDurationInMicroseconds());
+
+    int left = wheel.size();
+    t.start();
+    fired += wheel.advance(8000, [](int) {});
+    t.stop();
+    printResult("run out: fire every remaining hold", left, t.getDurationInMicroseconds());
+    benchSink += fired;
+
+    // 2. Expiry feeding waitlist promotion
+    int n = cfg.records < 6000 ? cfg.records : 6000;
+    BenchCabin cabin(n);
+    vector<BenchRecord> seats = seatedRecords(n);
+    ArraySystem* sys;
+    {
+        QuietScope quiet;
+        sys = new ArraySystem();
+        sys->setManualHoldClock(true);
+        for (const BenchRecord& r : seats) sys->holdSeat(r.id, r.name, r.row, r.col, r.fclass, 1 + rng() % ticks);
+        for (const BenchRecord& r : seats) sys->addToWaitlist(r.id + "W", r.name, r.row, r.col, r.fclass);
+    }
+    int expired;
+    {
+        QuietScope quiet;
+        t.start();
+        expired = sys->expireHoldsAt(ticks);
+        t.stop();
+        delete sys;
+    }
+    cout << n << " seats held, one waiter per seat" << endl;
+    printResult("ArraySystem: expire + promote from waitlist", expired, t.getDurationInMicroseconds());
+}
+
+// ==========================================
+// SUITE: Read Snapshots (copy-on-write seat grid)
+// One writer cancels and re-books random passengers on a full ArraySystem
+// while R reader threads keep producing a class report over every seat:
+//   none     -> writer alone
+//   snapshot -> readers walk the latest published snapshot (only the
+//               root copy takes atomic_load's short internal lock)
+//   mutex    -> readers lock the system and read the live structures
+//               (the writer takes the same lock for each booking)
+// Writer cost per cancel + re-book, and how many full reports the readers
+// finished meanwhile.
+// ==========================================
+enum SnapshotReaders { READERS_NONE, READERS_SNAPSHOT, READERS_MUTEX };
+
+long long timeSnapshotWriter(const vector<BenchRecord>& seated, const vector<int>& order, int readers, SnapshotReaders mode, long long& reports) {
+    ArraySystem* sys;
+    {
+        QuietScope quiet;
+        sys = new ArraySystem();
+        for (const BenchRecord& r : seated) sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+    }
+    mutex lock;
+    atomic<bool> done{false};
+    atomic<long long> finished{0};
+    int rows = FlightGlobal::totalRows();
+
+    auto reader = [&]() {
+        while (!done.load()) {
+            long long perClass[CLASS_COUNT] = { 0, 0, 0 };
+            if (mode == READERS_SNAPSHOT) {
+                shared_ptr<const SeatSnapshot> view = sys->snapshot();
+                view->forEachSeat([&](int, int, const SnapshotSeat& seat) {
+                    int cls = classCode(seat.flightClass);
+                    if (!seat.id.empty() && cls != CLASS_NONE) perClass[cls]++;
+                });
+            } else {
+                lock_guard<mutex> guard(lock);
+                for (Passenger* p : sys->queryPassengers(1, rows, CLASS_NONE, -1)) {
+                    int cls = classCode(p->flightClass);
+                    if (cls != CLASS_NONE) perClass[cls]++;
+                }
+            }
+            benchSink += perClass[CLASS_ECONOMY];
+            finished++;
+        }
+    };
+    vector<thread> pool;
+    if (mode != READERS_NONE) {
+        for (int i = 0; i < readers; i++) pool.emplace_back(reader);
+    }
+
+    Timer t;
+    {
+        QuietScope quiet;
+        t.start();
+        for (int i : order) {
+            const BenchRecord& r = seated[i];
+            if (mode == READERS_MUTEX) {
+                lock_guard<mutex> guard(lock);
+                sys->removePassenger(r.id);
+                sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+            } else {
+                sys->removePassenger(r.id);
+                sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+            }
+        }
+        t.stop();
+        done = true;
+        for (thread& th : pool) th.join();
+        delete sys;
+    }
+    reports = finished.load();
+    return t.getDurationInMicroseconds();
+}
+
+void suiteSnapshot(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: snapshot (writer vs concurrent readers) ===" << endl;
+    int n = cfg.records < 30000 ? cfg.records : 30000;
+    int ops = 100000;
+    int readers = 3;
+    BenchCabin cabin(n);
+    vector<BenchRecord> seated = seatedRecords(n);
+    mt19937 rng(41);
+    vector<int> order(ops);
+    for (int& i : order) i = rng() % n;
+
+    cout << n << " seated, " << ops << " cancel + re-book pairs, " << readers << " reader threads ("
+         << thread::hardware_concurrency() << " hardware threads)" << endl;
+    const char* labels[] = { "writer alone", "readers on snapshots (root copy only)", "readers under a mutex (live data)" };
+    for (int mode = READERS_NONE; mode <= READERS_MUTEX; mode++) {
+        long long reports = 0;
+        long long micros = timeSnapshotWriter(seated, order, readers, (SnapshotReaders)mode, reports);
+        printResult(labels[mode], ops, micros);
+        if (mode != READERS_NONE) cout << "  " << left << setw(44) << "  -> full reports by readers" << right << setw(10) << reports << endl;
+    }
+}
+
+// ==========================================
+// SUITE: Flight Statistics (dashboard polling)
+// flightStats() reads counters kept on every change; the recount walks
+// every seated passenger (row buckets) for the same per-class numbers.
+// ==========================================
+template <typename System>
+void runStatsFor(const string& label, const vector<BenchRecord>& seated, const vector<BenchRecord>& waiting, int polls) {
+    System* sys;
+    {
+        QuietScope quiet;
+        sys = new System();
+        for (const BenchRecord& r : seated) sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+        for (const BenchRecord& r : waiting) sys->addToWaitlist(r.id, r.name, r.row, r.col, r.fclass);
+    }
+    long long sum = 0;
+    Timer t;
+    t.start();
+    for (int i = 0; i < polls; i++) {
+        FlightStats st;
+        sys->flightStats(st);
+        sum += st.seated[CLASS_ECONOMY] + st.waitingTotal + st.highestRow;
+    }
+    t.stop();
+    printResult(label + ", flightStats()", polls, t.getDurationInMicroseconds());
+
+    int recounts = polls / 10000 > 0 ? polls / 10000 : 1;
+    int rows = FlightGlobal::totalRows();
+    t.start();
+    for (int i = 0; i < recounts; i++) {
+        int perClass[CLASS_COUNT + 1] = { 0, 0, 0, 0 };
+        int highest = 0;
+        for (Passenger* p : sys->queryPassengers(1, rows, CLASS_NONE, -1)) {
+            perClass[FlightGlobal::layout().classOfRow(p->seatRow)]++;
+            if (p->seatRow > highest) highest = p->seatRow;
+        }
+        sum += perClass[CLASS_ECONOMY] + highest;
+    }
+    t.stop();
+    printResult(label + ", recount seated passengers", recounts, t.getDurationInMicroseconds());
+    benchSink += sum;
+    QuietScope quiet;
+    delete sys;
+}
+
+void suiteStats(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: stats (incremental counters vs recount) ===" << endl;
+    int n = cfg.records;
+    int w = n / 10;
+    BenchCabin cabin(n);
+    vector<BenchRecord> seated = seatedRecords(n);
+    vector<BenchRecord> waiting(seated.begin(), seated.begin() + w);
+    for (int i = 0; i < w; i++) waiting[i].id = to_string(900000 + i);
+    int polls = cfg.queries;
+
+    cout << n << " seated, " << w << " waiting, " << polls << " polls" << endl;
+    runStatsFor<ArraySystem>("ArraySystem", seated, waiting, polls);
+    runStatsFor<SkipListSystem>("SkipListSystem", seated, waiting, polls);
+}
+
+// ==========================================
+// SUITE: Change Feed (event stream)
+// 1. Cost of publishing: cancel + re-book pairs with the feed on / off.
+// 2. A subscriber's per-class seat view refreshed after every 100 changes:
+//    apply the new events (O(changes)) vs re-scan every seated passenger.
+// 3. FeedFileWriter: events per second from the ring to a CSV file.
+// ==========================================
+long long timeFeedWriter(const vector<BenchRecord>& seated, const vector<int>& order, bool feedOn) {
+    QuietScope quiet;
+    ArraySystem sys;
+    for (const BenchRecord& r : seated) sys.addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+    sys.setChangeFeed(feedOn);
+    Timer t;
+    t.start();
+    for (int i : order) {
+        const BenchRecord& r = seated[i];
+        sys.removePassenger(r.id);
+        sys.addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+    }
+    t.stop();
+    return t.getDurationInMicroseconds();
+}
+
+void suiteFeed(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: feed (change events vs re-scans) ===" << endl;
+    int n = cfg.records < 50000 ? cfg.records : 50000;
+    int ops = 200000;
+    BenchCabin cabin(n);
+    vector<BenchRecord> seated = seatedRecords(n);
+    mt19937 rng(47);
+    vector<int> order(ops);
+    for (int& i : order) i = rng() % n;
+
+    cout << n << " seated, " << ops << " cancel + re-book pairs" << endl;
+    long long best[2] = { -1, -1 };
+    for (int rep = 0; rep < cfg.repeat; rep++) {
+        for (int on = 0; on < 2; on++) {
+            long long us = timeFeedWriter(seated, order, on == 1);
+            if (best[on] < 0 || us < best[on]) best[on] = us;
+        }
+    }
+    printResult("pair, feed off", ops, best[0]);
+    printResult("pair, feed on (2 events)", ops, best[1]);
+
+    // 2. Subscriber view: seated count per class
+    ArraySystem* sys;
+    {
+        QuietScope quiet;
+        sys = new ArraySystem();
+        for (const BenchRecord& r : seated) sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+    }
+    const int batch = 100;
+    int refreshes = 200;
+    int rows = FlightGlobal::totalRows();
+    FeedCursor cursor(*sys->changeFeed());
+    vector<ChangeEvent> events;
+    int view[CLASS_COUNT + 1] = { 0, 0, 0, 0 };
+    view[CLASS_ECONOMY] = n;
+    long long applyMicros = 0, rescanMicros = 0, sum = 0;
+    Timer t;
+    for (int k = 0; k < refreshes; k++) {
+        {
+            QuietScope quiet;
+            for (int i = 0; i < batch; i++) {
+                const BenchRecord& r = seated[order[k * batch + i]];
+                sys->removePassenger(r.id);
+                sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+            }
+        }
+        t.start();
+        events.clear();
+        cursor.poll(events, 4096);
+        for (const ChangeEvent& e : events) {
+            if (e.type == CHANGE_SEAT_ADD) view[e.flightClass]++;
+            else if (e.type == CHANGE_SEAT_REMOVE) view[e.flightClass]--;
+        }
+        t.stop();
+        applyMicros += t.getDurationInMicroseconds();
+
+        t.start();
+        int perClass[CLASS_COUNT + 1] = { 0, 0, 0, 0 };
+        for (Passenger* p : sys->queryPassengers(1, rows, CLASS_NONE, -1)) perClass[classCode(p->flightClass)]++;
+        t.stop();
+        rescanMicros += t.getDurationInMicroseconds();
+        sum += perClass[CLASS_ECONOMY] - view[CLASS_ECONOMY]; // 0 when the view is right
+    }
+    printResult("refresh view from the feed (100 changes)", refreshes, applyMicros);
+    printResult("refresh view by re-scan", refreshes, rescanMicros);
+    if (sum != 0 || cursor.lost() > 0) cout << "  !! view out of sync (" << cursor.lost() << " events lost)" << endl;
+
+    // 3. File-backed consumer
+    string path = "bench_feed.csv";
+    FeedFileWriter writer;
+    long long written = 0, lost = 0;
+    if (writer.open(path)) {
+        writer.follow(*sys->changeFeed(), "array");
+        {
+            QuietScope quiet;
+            t.start();
+            writer.start();
+            for (int i = 0; i < ops / 4; i++) {
+                const BenchRecord& r = seated[order[i]];
+                sys->removePassenger(r.id);
+                sys->addPassenger(r.id, r.name, r.row, r.col, r.fclass);
+            }
+            writer.stop();
+            t.stop();
+        }
+        written = writer.eventsWritten();
+        lost = writer.eventsLost();
+        writer.close();
+        remove(path.c_str());
+        printResult("pairs + file writer until drained", ops / 4, t.getDurationInMicroseconds());
+        cout << "  " << left << setw(44) << "  -> events written / lost" << right << setw(10) << written << " / " << lost << endl;
+    }
+    benchSink += sum;
+    QuietScope quiet;
+    delete sys;
+}
+
+// ==========================================
+// SUITE: Follow Mode (tail the CSV)
+// A writer thread appends one booking row at a time; the follower waits
+// on inotify, reads only the new complete lines and books them. Latency
+// is measured from the append to the moment the row is bookable.
+// Compared with restarting and re-loading the whole file.
+// ==========================================
+void suiteFollow(const BenchConfig& cfg) {
+    cout << "\n=== SUITE: follow (append -> bookable latency vs full reload) ===" << endl;
+    typedef chrono::steady_clock Clock;
+    int base = cfg.records < 50000 ? cfg.records : 50000;
+    int appends = 2000;
+    BenchCabin cabin(base + appends);
+    vector<BenchRecord> recs = seatedRecords(base + appends);
+    string path = "bench_follow.csv";
+
+    FILE* out = fopen(path.c_str(), "w");
+    if (out == nullptr) {
+        cout << "  cannot create " << path << endl;
+        return;
+    }
+    fputs("PassengerID,Name,SeatRow,SeatColumn,Class\n", out);
+    for (int i = 0; i < base; i++) {
+        const BenchRecord& r = recs[i];
+        fprintf(out, "%s,%s,%d,%s,%s\n", r.id.c_str(), r.name.c_str(), r.row, r.col.c_str(), r.fclass.c_str());
+    }
+    fclose(out);
+
+    ArraySystem* sys;
+    CsvFollowThread tail; // Same path as main --follow: rows booked on the follow thread
+    CsvFollower& follower = tail.reader();
+    vector<string> lines;
+    {
+        QuietScope quiet;
+        sys = new ArraySystem();
+        follower.open(path);
+        follower.readLines(lines);
+        ingestLines(sys, lines);
+    }
+
+    // Writer: one row per write, ~100 us apart
+    vector<atomic<long long>> appendedAt(appends);
+    thread writer([&]() {
+        FILE* f = fopen(path.c_str(), "a");
+        for (int i = 0; i < appends; i++) {
+            const BenchRecord& r = recs[base + i];
+            appendedAt[i].store(Clock::now().time_since_epoch().count());
+            fprintf(f, "%s,%s,%d,%s,%s\n", r.id.c_str(), r.name.c_str(), r.row, r.col.c_str(), r.fclass.c_str());
+            fflush(f);
+            this_thread::sleep_for(chrono::microseconds(100));
+        }
+        fclose(f);
+    });
+
+    // Follow thread: books each batch under the system lock as soon as it is read
+    mutex systemLock;
+    vector<long long> latency;      // ns, file append -> booked
+    vector<long long> eventLatency; // ns, inotify event (or poll tick) -> booked
+    long long ingestNs = 0;
+    long long firstId = stoll(recs[base].id);
+    atomic<int> bookedRows{0};
+    tail.start([&](const vector<string>& batch, Clock::time_point seenAt) {
+        lock_guard<mutex> guard(systemLock);
+        Clock::time_point start = Clock::now();
+        {
+            QuietScope quiet;
+            ingestLines(sys, batch);
+        }
+        Clock::time_point booked = Clock::now();
+        ingestNs += chrono::duration_cast<chrono::nanoseconds>(booked - start).count();
+        for (const string& line : batch) {
+            long long idx = stoll(line.substr(0, line.find(','))) - firstId;
+            if (idx < 0 || idx >= appends) continue;
+            latency.push_back(booked.time_since_epoch().count() - appendedAt[idx].load());
+            eventLatency.push_back(chrono::duration_cast<chrono::nanoseconds>(booked - seenAt).count());
+        }
+        bookedRows.fetch_add((int)batch.size());
+    });
+    writer.join();
+    while (bookedRows.load() < appends) this_thread::sleep_for(chrono::milliseconds(1));
+    tail.stop();
+    sort(latency.begin(), latency.end());
+    sort(eventLatency.begin(), eventLatency.end());
+    bool allBooked = sys->searchPassenger(recs.back().id) != nullptr;
+
+    cout << base << " rows loaded, " << appends << " rows appended one by one ("
+         << (follower.usesInotify() ? "inotify" : "polling") << ")" << endl;
+    printResult("book appended rows (follow thread)", appends, ingestNs / 1000);
+    cout << "  " << left << setw(44) << "  -> append -> booked p50 / p99 / max" << right << setw(10)
+         << latency[latency.size() / 2] / 1000 << " / " << latency[latency.size() * 99 / 100] / 1000
+         << " / " << latency.back() / 1000 << " us" << endl;
+    cout << "  " << left << setw(44) << (follower.usesInotify() ? "  -> inotify event -> booked p50 / p99 / max" : "  -> poll tick -> booked p50 / p99 / max")
+         << right << setw(10) << eventLatency[eventLatency.size() / 2] / 1000 << " / "
+         << eventLatency[eventLatency.size() * 99 / 100] / 1000 << " / " << eventLatency.back() / 1000 << " us" << endl;
+    if (!allBooked) cout << "  !! last appended row was not booked" << endl;
+
+    // Restart instead: load every row again into a new system
+    Timer t;
+    {
+        QuietScope quiet;
+        ArraySystem fresh;
+        t.start();
+        loadData(&fresh, path);
+        t.stop();
+    }
+    printResult("restart: reload the whole file", base + appends, t.getDurationInMicroseconds());
+
+    QuietScope quiet;
+    delete sys;
+    remove(path.c_str());
+}
+
+// ==========================================
+// MAIN FUNCTION
+// ==========================================
+struct Suite {
+    const char* name;
+    void (*run)(const BenchConfig&);
+};
+
+static const Suite SUITES[] = {
+    { "dispatch", suiteDispatch },
+    { "names", suiteNames },
+    { "cancel", suiteCancel },
+    { "scan", suiteScan },
+    { "zipf", suiteZipf },
+    { "bloom", suiteBloom },
+    { "simd", suiteSimd },
+    { "parallel", suiteParallel },
+    { "log", suiteLog },
+    { "waitlist", suiteWaitlist },
+    { "holds", suiteHolds },
+    { "snapshot", suiteSnapshot },
+    { "stats", suiteStats },
+    { "feed", suiteFeed },
+    { "follow", suiteFollow },
+};
+static const int SUITE_COUNT = sizeof(SUITES) / sizeof(SUITES[0]);
+
+int main(int argc, char* argv[]) {
+    BenchConfig cfg;
+    vector<string> selected;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--records" && i + 1 < argc) cfg.records = atoi(argv[++i]);
+        else if (arg == "--queries" && i + 1 < argc) cfg.queries = atoi(argv[++i]);
+        else if (arg == "--repeat" && i + 1 < argc) cfg.repeat = atoi(argv[++i]);
+        else if (arg == "--help" || arg == "-h") {
+            cout << "Usage: bench [suite ...] [--records N] [--queries N] [--repeat N]\nSuites:";
+            for (int s = 0; s < SUITE_COUNT; s++) cout << " " << SUITES[s].name;
+            cout << endl;
+            return 0;
+        } else selected.push_back(arg);
+    }
+    if (cfg.records < 1) cfg.records = 1;
+    if (cfg.queries < 1) cfg.queries = 1;
+    if (cfg.repeat < 1) cfg.repeat = 1;
+
+    for (int s = 0; s < SUITE_COUNT; s++) {
+        bool run = selected.empty();
+        for (const string& name : selected) if (name == SUITES[s].name) run = true;
+        if (run) SUITES[s].run(cfg);
+    }
+    return 0;
+}
@@ -0,0 +1,299 @@
+#ifndef CHANGEFEED_HPP
+#define CHANGEFEED_HPP
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+#include "AircraftLayout.hpp"
+
+using namespace std;
+
+// What changed (ChangeEvent::type)
+enum ChangeType {
+    CHANGE_SEAT_ADD = 1,   // Passenger seated (addPassenger, auto-fill, confirmed hold)
+    CHANGE_SEAT_REMOVE,    // Passenger left the seat (removePassenger, batch cancel)
+    CHANGE_WAIT_JOIN,      // Joined the waitlist (row / col = seat asked for)
+    CHANGE_WAIT_LEAVE,     // Left the waitlist without a seat (cancelled)
+    CHANGE_PROMOTE         // Left the waitlist for the seat in row / col (published right after its SEAT_ADD)
+};
+
+inline const char* changeTypeName(int type) {
+    switch (type) {
+        case CHANGE_SEAT_ADD: return "ADD";
+        case CHANGE_SEAT_REMOVE: return "REMOVE";
+        case CHANGE_WAIT_JOIN: return "WAIT";
+        case CHANGE_WAIT_LEAVE: return "UNWAIT";
+        case CHANGE_PROMOTE: return "PROMOTE";
+    }
+    return "?";
+}
+
+// ==========================================
+// STRUCT: ChangeEvent
+// One reservation change, fixed size (one cache line) so the feed never
+// allocates. IDs and names longer than 23 characters are cut.
+// ==========================================
+struct ChangeEvent {
+    uint64_t seq;         // Position in the feed: 0, 1, 2 ...
+    uint8_t type;         // ChangeType
+    uint8_t flightClass;  // classCode() of the ticket class
+    char col;             // Seat column letter, 0 = none
+    uint8_t reserved;
+    int32_t row;          // Seat row, 0 = none
+    char id[24];
+    char name[24];
+
+    string idText() const { return string(id); }
+    string nameText() const { return string(name); }
+};
+static_assert(sizeof(ChangeEvent) == 64, "ChangeEvent should stay one cache line");
+
+// ==========================================
+// CLASS: ChangeFeed
+// Description: Bounded, lock-free ring of the last 'capacity' changes of
+// one system (broadcast: every subscriber sees every event).
+// 1. The owning system is the only writer. publish() fills the slot for
+//    the next sequence number and bumps 'head' - no lock, no allocation,
+//    and it never waits for readers.
+// 2. Each slot has a version (seqlock): odd while it is being written,
+//    2 * seq + 2 once event 'seq' is complete. A reader copies the slot and
+//    keeps the copy only if the version was the same before and after.
+// 3. A subscriber that falls more than 'capacity' events behind loses the
+//    oldest ones (counted by its FeedCursor) instead of slowing the writer.
+// ==========================================
+class ChangeFeed {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 8192;
+    static constexpr int WORDS = sizeof(ChangeEvent) / sizeof(uint64_t);
+
+private:
+    struct Slot {
+        atomic<uint64_t> version;
+        atomic<uint64_t> words[WORDS]; // The event, copied word by word
+    };
+
+    Slot* ring;
+    size_t capacity;
+    atomic<uint64_t> head{0};     // Events published so far (= next seq)
+    atomic<bool> enabled{true};
+
+    static void copyText(char* dst, size_t size, const string& src) {
+        size_t n = src.size() < size - 1 ? src.size() : size - 1;
+        memcpy(dst, src.data(), n);
+        memset(dst + n, 0, size - n);
+    }
+
+public:
+    explicit ChangeFeed(size_t minCapacity = DEFAULT_CAPACITY) {
+        capacity = 1;
+        while (capacity < minCapacity) capacity <<= 1;
+        ring = new Slot[capacity];
+        for (size_t i = 0; i < capacity; i++) ring[i].version.store(0, memory_order_relaxed);
+    }
+
+    ~ChangeFeed() { delete[] ring; }
+
+    ChangeFeed(const ChangeFeed&) = delete;
+    ChangeFeed& operator=(const ChangeFeed&) = delete;
+
+    size_t size() const { return capacity; }
+    uint64_t published() const { return head.load(memory_order_acquire); }
+
+    // Benchmark switch: off = publish() returns at once
+    void setEnabled(bool on) { enabled.store(on, memory_order_relaxed); }
+    bool isEnabled() const { return enabled.load(memory_order_relaxed); }
+
+    // Function: Append one event (single writer: the owning system)
+    void publish(int type, const string& id, const string& name, int row, const string& col, const string& fclass) {
+        if (!enabled.load(memory_order_relaxed)) return;
+
+        ChangeEvent e;
+        e.seq = head.load(memory_order_relaxed);
+        e.type = (uint8_t)type;
+        e.flightClass = (uint8_t)classCode(fclass);
+        e.col = col.empty() ? 0 : col[0];
+        e.reserved = 0;
+        e.row = row;
+        copyText(e.id, sizeof(e.id), id);
+        copyText(e.name, sizeof(e.name), name);
+
+        uint64_t words[WORDS];
+        memcpy(words, &e, sizeof(e));
+        Slot& s = ring[e.seq & (capacity - 1)];
+        s.version.store(2 * e.seq + 1, memory_order_relaxed); // Odd: readers of the old event back off
+        atomic_thread_fence(memory_order_release);
+        for (int i = 0; i < WORDS; i++) s.words[i].store(words[i], memory_order_relaxed);
+        s.version.store(2 * e.seq + 2, memory_order_release);
+        head.store(e.seq + 1, memory_order_release);
+    }
+
+    // Function: Copy event 'seq' into 'out'. False if it is not published
+    // yet or was already overwritten (the ring went round).
+    bool read(uint64_t seq, ChangeEvent& out) const {
+        const Slot& s = ring[seq & (capacity - 1)];
+        uint64_t before = s.version.load(memory_order_acquire);
+        if (before != 2 * seq + 2) return false;
+        uint64_t words[WORDS];
+        for (int i = 0; i < WORDS; i++) words[i] = s.words[i].load(memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+        if (s.version.load(memory_order_relaxed) != before) return false; // Rewritten while we copied
+        memcpy(&out, words, sizeof(out));
+        return true;
+    }
+};
+
+// ==========================================
+// CLASS: FeedCursor
+// Description: One subscriber's read position in a ChangeFeed. poll()
+// returns only what changed since the last call, so a view kept up to
+// date from it costs O(changes), not a re-scan of the manifest.
+// If lost() grows, events were overwritten before they were read: the
+// subscriber should rebuild its view from the system once.
+// ==========================================
+class FeedCursor {
+private:
+    const ChangeFeed* feed;
+    uint64_t nextSeq;
+    long long lostEvents = 0;
+
+public:
+    // fromStart: also deliver the events still in the ring; else only new ones
+    explicit FeedCursor(const ChangeFeed& f, bool fromStart = false) : feed(&f) {
+        uint64_t h = f.published();
+        nextSeq = !fromStart ? h : (h > f.size() ? h - f.size() : 0);
+    }
+
+    uint64_t position() const { return nextSeq; }
+    long long lost() const { return lostEvents; }
+    uint64_t behind() const { return feed->published() - nextSeq; }
+
+    // Function: Append up to 'max' new events to 'out'; returns how many
+    int poll(vector<ChangeEvent>& out, int max = 256) {
+        int got = 0;
+        ChangeEvent e;
+        while (got < max) {
+            uint64_t h = feed->published();
+            if (nextSeq >= h) break;
+            if (h - nextSeq > feed->size()) { // Lapped: skip to the oldest event still there
+                lostEvents += (long long)(h - feed->size() - nextSeq);
+                nextSeq = h - feed->size();
+            }
+            if (feed->read(nextSeq, e)) {
+                out.push_back(e);
+                got++;
+            } else {
+                lostEvents++; // Overwritten while we were reading it
+            }
+            nextSeq++;
+        }
+        return got;
+    }
+};
+
+// ==========================================
+// CLASS: FeedFileWriter
+// Description: File-backed subscriber. A background thread follows one or
+// more feeds and appends every event as a CSV line:
+//   seq,source,type,id,name,row,col,class
+// Lines are batched (one fwrite per poll round, fflush when idle), so the
+// systems never wait on disk. Lost events are written as "# lost ..." lines.
+// ==========================================
+class FeedFileWriter {
+private:
+    struct Source {
+        FeedCursor cursor;
+        string tag;
+        long long reportedLost;
+    };
+
+    vector<Source> sources;
+    FILE* out = nullptr;
+    thread worker;
+    atomic<bool> running{false};
+    atomic<long long> linesWritten{0};
+
+    void writerLoop() {
+        vector<ChangeEvent> batch;
+        string text;
+        char line[160];
+        while (true) {
+            bool stopping = !running.load(memory_order_acquire); // Read first: a stop still drains what came before it
+            int got = 0;
+            for (Source& src : sources) {
+                batch.clear();
+                got += src.cursor.poll(batch, 1024);
+                if (src.cursor.lost() != src.reportedLost) {
+                    snprintf(line, sizeof(line), "# lost %lld events (%s)\n", src.cursor.lost() - src.reportedLost, src.tag.c_str());
+                    text += line;
+                    src.reportedLost = src.cursor.lost();
+                }
+                for (const ChangeEvent& e : batch) {
+                    int n = snprintf(line, sizeof(line), "%llu,%s,%s,%s,%s,%d,%c,%s\n", (unsigned long long)e.seq, src.tag.c_str(),
+                                     changeTypeName(e.type), e.id, e.name, e.row, e.col != 0 ? e.col : '-', className(e.flightClass).c_str());
+                    text.append(line, n < (int)sizeof(line) ? n : sizeof(line) - 1);
+                }
+            }
+            if (!text.empty()) {
+                fwrite(text.data(), 1, text.size(), out);
+                text.clear();
+                linesWritten.fetch_add(got, memory_order_relaxed);
+            }
+            if (got == 0) {
+                fflush(out);
+                if (stopping) return;
+                this_thread::sleep_for(chrono::milliseconds(1));
+            }
+        }
+    }
+
+public:
+    ~FeedFileWriter() { close(); }
+
+    // Function: Create / truncate the output file. False if it cannot be opened.
+    bool open(const string& path) {
+        close();
+        out = fopen(path.c_str(), "w");
+        if (out == nullptr) return false;
+        fputs("seq,source,type,id,name,row,col,class\n", out);
+        return true;
+    }
+
+    // Function: Add a feed (before start); 'tag' names it in the file
+    void follow(const ChangeFeed& feed, const string& tag) {
+        sources.push_back(Source{ FeedCursor(feed, true), tag, 0 });
+    }
+
+    void start() {
+        if (out == nullptr || running.exchange(true)) return;
+        worker = thread(&FeedFileWriter::writerLoop, this);
+    }
+
+    // Function: Write everything published so far, then stop the thread
+    void stop() {
+        if (running.exchange(false)) worker.join();
+    }
+
+    void close() {
+        stop();
+        if (out != nullptr) fclose(out);
+        out = nullptr;
+        sources.clear();
+    }
+
+    long long eventsWritten() const { return linesWritten.load(); }
+
+    // Lost events over all feeds (read it after stop())
+    long long eventsLost() const {
+        long long total = 0;
+        for (const Source& src : sources) total += src.cursor.lost();
+        return total;
+    }
+};
+
+#endif
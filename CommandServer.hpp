@@ -0,0 +1,336 @@
+#ifndef COMMANDSERVER_HPP
+#define COMMANDSERVER_HPP
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cerrno>
+#include <mutex>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "FlightCommon.hpp"
+
+using namespace std;
+
+// ==========================================
+// MODULE: CommandServer (Pipelined Line Protocol)
+// Description: Non-interactive front end for one FlightSystem, over
+// stdin/stdout or a Unix-domain socket. One command per line, fields
+// separated by commas (same layout as a CSV row); one response per
+// command, in order:
+//   PING                          -> OK
+//   ADD,id,name,row,col,class     -> OK | WAITLIST | FAIL
+//   AUTO,id,name,class[,pref]     -> OK,row,col | FAIL   (pref: 0 any, 1 window, 2 aisle)
+//   REMOVE,id                     -> OK | NOTFOUND
+//   SEARCH,id                     -> OK,id,name,row,col,class | NOTFOUND (waitlisted: row 0, col WL)
+//   WAIT,id,name,row,col,class    -> OK
+//   UNWAIT,id                     -> OK | NOTFOUND | ERR,not supported
+//   STATS                         -> OK,seatedF,seatedB,seatedE,freeF,freeB,freeE,waiting
+//   MANIFEST[,fromRow,toRow]      -> OK,n followed by n lines id,name,row,col,class
+//   QUIT                          -> BYE (connection closed)
+//   SHUTDOWN                      -> BYE (server stops)
+//   anything else                 -> ERR,<reason>
+// Clients may pipeline: send many commands without waiting. Everything
+// that arrived in one read is run as a batch and all of its responses go
+// back in one write. Commands run one at a time on the server thread, so
+// the systems stay single-threaded; with setSystemLock() each batch also
+// holds that lock (follow mode books rows on another thread).
+// ==========================================
+class CommandServer {
+public:
+    static constexpr size_t READ_BYTES = 64 * 1024;
+    static constexpr size_t MAX_PENDING_OUT = 4 * 1024 * 1024; // Stop reading a client that does not read its answers
+
+private:
+    FlightSystem* sys;
+    mutex* systemLock = nullptr; // Held while a batch runs (optional)
+    vector<string> fields;
+    long long commandCount = 0;
+    long long batchCount = 0;
+    bool shutdownRequested = false;
+
+    struct Connection {
+        int fd;
+        string in;
+        string out;
+        bool closing;   // QUIT / EOF: close once 'out' is written
+    };
+
+    void split(const string& line) {
+        fields.clear();
+        size_t start = 0;
+        while (true) {
+            size_t comma = line.find(',', start);
+            if (comma == string::npos) {
+                fields.push_back(line.substr(start));
+                return;
+            }
+            fields.push_back(line.substr(start, comma - start));
+            start = comma + 1;
+        }
+    }
+
+    static bool toInt(const string& s, int& value) {
+        try {
+            size_t used = 0;
+            value = stoi(s, &used);
+            return used == s.size();
+        } catch (...) {
+            return false;
+        }
+    }
+
+    static void appendPassenger(string& out, const Passenger* p) {
+        out += p->passengerID;
+        out += ',';
+        out += p->name;
+        out += ',';
+        out += to_string(p->seatRow);
+        out += ',';
+        out += p->seatCol;
+        out += ',';
+        out += p->flightClass;
+        out += '\n';
+    }
+
+    // Write as much of 'data' as the descriptor takes; false on error
+    static bool writeSome(int fd, string& data) {
+        size_t done = 0;
+        while (done < data.size()) {
+            ssize_t n = ::write(fd, data.data() + done, data.size() - done);
+            if (n > 0) {
+                done += n;
+            } else if (n < 0 && errno == EINTR) {
+                continue;
+            } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                break;
+            } else {
+                return false;
+            }
+        }
+        data.erase(0, done);
+        return true;
+    }
+
+public:
+    explicit CommandServer(FlightSystem* system) : sys(system) {}
+
+    long long commands() const { return commandCount; }
+    long long batches() const { return batchCount; }
+
+    // Function: Share the system with another thread: every batch runs
+    // under 'lock'
+    void setSystemLock(mutex* lock) { systemLock = lock; }
+
+    // Function: Run one command line; its response is appended to 'out'.
+    // Returns false for QUIT / SHUTDOWN.
+    bool execute(const string& line, string& out) {
+        commandCount++;
+        split(line);
+        string& cmd = fields[0];
+        if (!cmd.empty() && cmd.back() == '\r') cmd.pop_back();
+        if (fields.size() > 1 && !fields.back().empty() && fields.back().back() == '\r') fields.back().pop_back();
+        int row = 0;
+
+        if (cmd == "ADD" && fields.size() == 6 && toInt(fields[3], row)) {
+            if (sys->addPassenger(fields[1], fields[2], row, fields[4], fields[5])) out += "OK\n";
+            else {
+                Passenger* p = sys->searchPassenger(fields[1]);
+                out += (p != nullptr && p->seatRow == 0) ? "WAITLIST\n" : "FAIL\n";
+            }
+        } else if (cmd == "AUTO" && (fields.size() == 4 || fields.size() == 5)) {
+            int pref = SEAT_ANY;
+            if (fields.size() == 5 && (!toInt(fields[4], pref) || pref < 0 || pref >= SEAT_PREF_COUNT)) pref = SEAT_ANY;
+            if (sys->autoAssignPassenger(fields[1], fields[2], fields[3], pref)) {
+                Passenger* p = sys->searchPassenger(fields[1]);
+                out += "OK," + to_string(p != nullptr ? p->seatRow : 0) + "," + (p != nullptr ? p->seatCol : "") + "\n";
+            } else {
+                out += "FAIL\n";
+            }
+        } else if (cmd == "REMOVE" && fields.size() == 2) {
+            out += sys->removePassenger(fields[1]) ? "OK\n" : "NOTFOUND\n";
+        } else if (cmd == "SEARCH" && fields.size() == 2) {
+            Passenger* p = sys->searchPassenger(fields[1]);
+            if (p == nullptr) {
+                out += "NOTFOUND\n";
+            } else {
+                out += "OK,";
+                appendPassenger(out, p);
+            }
+        } else if (cmd == "WAIT" && fields.size() == 6 && toInt(fields[3], row)) {
+            sys->addToWaitlist(fields[1], fields[2], row, fields[4], fields[5]);
+            out += "OK\n";
+        } else if (cmd == "UNWAIT" && fields.size() == 2) {
+            if (!sys->supportsCancelWaitlist()) out += "ERR,not supported\n";
+            else out += sys->cancelWaitlist(fields[1]) ? "OK\n" : "NOTFOUND\n";
+        } else if (cmd == "STATS" && fields.size() == 1) {
+            FlightStats st;
+            if (!sys->flightStats(st)) {
+                out += "ERR,stats not available\n";
+            } else {
+                out += "OK";
+                for (int c = 0; c < CLASS_COUNT; c++) out += "," + to_string(st.seated[c]);
+                for (int c = 0; c < CLASS_COUNT; c++) out += "," + to_string(st.freeSeats[c]);
+                out += "," + to_string(st.waitingTotal) + "\n";
+            }
+        } else if (cmd == "MANIFEST" && (fields.size() == 1 || fields.size() == 3)) {
+            int fromRow = 1, toRow = FlightGlobal::totalRows();
+            if (fields.size() == 3 && (!toInt(fields[1], fromRow) || !toInt(fields[2], toRow))) {
+                out += "ERR,bad row range\n";
+                return true;
+            }
+            vector<Passenger*> seated = sys->queryPassengers(fromRow, toRow, CLASS_NONE, -1);
+            out += "OK," + to_string(seated.size()) + "\n";
+            for (Passenger* p : seated) appendPassenger(out, p);
+        } else if (cmd == "PING") {
+            out += "OK\n";
+        } else if (cmd == "QUIT" || cmd == "SHUTDOWN") {
+            out += "BYE\n";
+            if (cmd == "SHUTDOWN") shutdownRequested = true;
+            return false;
+        } else if (cmd.empty()) {
+            out += "ERR,empty command\n";
+        } else {
+            out += "ERR,unknown command or wrong field count: " + cmd + "\n";
+        }
+        return true;
+    }
+
+    // Function: Run every complete line in 'in' (a trailing partial line
+    // stays for the next read). Returns false once QUIT / SHUTDOWN was seen;
+    // the lines after it are dropped.
+    bool executeBatch(string& in, string& out) {
+        unique_lock<mutex> guard;
+        if (systemLock != nullptr) guard = unique_lock<mutex>(*systemLock);
+        size_t start = 0;
+        bool keepGoing = true;
+        while (keepGoing) {
+            size_t nl = in.find('\n', start);
+            if (nl == string::npos) break;
+            keepGoing = execute(in.substr(start, nl - start), out);
+            start = nl + 1;
+        }
+        in.erase(0, keepGoing ? start : in.size());
+        batchCount++;
+        return keepGoing;
+    }
+
+    // Function: At EOF, run a last line that came without '\n'
+    void executeLastLine(string& in, string& out) {
+        if (in.empty()) return;
+        in += '\n';
+        executeBatch(in, out);
+    }
+
+    // Function: Serve one client on a pair of descriptors (stdin / stdout)
+    // until EOF or QUIT. Blocking: read a chunk, run it, write the answers.
+    void serveStream(int inFd, int outFd) {
+        string in, out;
+        char buf[READ_BYTES];
+        while (true) {
+            ssize_t n = ::read(inFd, buf, sizeof(buf));
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) break;
+            in.append(buf, n);
+            bool keepGoing = executeBatch(in, out);
+            if (!writeSome(outFd, out) || !keepGoing) break;
+        }
+        if (!in.empty()) {
+            executeLastLine(in, out);
+            writeSome(outFd, out);
+        }
+    }
+
+    // Function: Listen on a Unix-domain socket at 'path' and serve any
+    // number of clients from one poll() loop until SHUTDOWN.
+    // False if the socket cannot be created.
+    bool serveUnix(const string& path) {
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path)) return false;
+        strcpy(addr.sun_path, path.c_str());
+
+        int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listenFd < 0) return false;
+        ::unlink(path.c_str()); // Stale socket of an earlier run
+        if (bind(listenFd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listenFd, 64) < 0) {
+            ::close(listenFd);
+            return false;
+        }
+        fcntl(listenFd, F_SETFL, fcntl(listenFd, F_GETFL) | O_NONBLOCK);
+
+        vector<Connection> conns;
+        vector<pollfd> pfds;
+        char buf[READ_BYTES];
+        while (!shutdownRequested) {
+            pfds.clear();
+            pfds.push_back(pollfd{ listenFd, POLLIN, 0 });
+            for (const Connection& c : conns) {
+                short events = 0;
+                if (!c.closing && c.out.size() < MAX_PENDING_OUT) events |= POLLIN;
+                if (!c.out.empty()) events |= POLLOUT;
+                pfds.push_back(pollfd{ c.fd, events, 0 });
+            }
+            if (::poll(pfds.data(), pfds.size(), -1) < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+
+            for (size_t i = 0; i < conns.size(); i++) {
+                Connection& c = conns[i];
+                short revents = pfds[i + 1].revents;
+                bool failed = (revents & (POLLERR | POLLNVAL)) != 0;
+                if (!failed && (revents & (POLLIN | POLLHUP)) && !c.closing) {
+                    ssize_t n = ::read(c.fd, buf, sizeof(buf));
+                    if (n > 0) {
+                        c.in.append(buf, n);
+                        if (!executeBatch(c.in, c.out)) c.closing = true;
+                    } else if (n == 0) {
+                        executeLastLine(c.in, c.out); // Client hung up: same as serveStream
+                        c.closing = true;
+                    } else if (errno != EAGAIN && errno != EINTR) {
+                        c.closing = true; // Read error
+                    }
+                }
+                if (!failed && !c.out.empty()) failed = !writeSome(c.fd, c.out);
+                if (failed || (c.closing && c.out.empty())) {
+                    ::close(c.fd);
+                    c.fd = -1;
+                }
+            }
+            for (size_t i = 0; i < conns.size();) {
+                if (conns[i].fd < 0) {
+                    conns[i] = move(conns.back());
+                    conns.pop_back();
+                } else {
+                    i++;
+                }
+            }
+
+            if (pfds[0].revents & POLLIN) {
+                while (true) {
+                    int fd = accept(listenFd, nullptr, nullptr);
+                    if (fd < 0) break;
+                    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+                    conns.push_back(Connection{ fd, "", "", false });
+                }
+            }
+        }
+
+        for (Connection& c : conns) {
+            writeSome(c.fd, c.out);
+            ::close(c.fd);
+        }
+        ::close(listenFd);
+        ::unlink(path.c_str());
+        return true;
+    }
+};
+
+#endif
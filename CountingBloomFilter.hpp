@@ -0,0 +1,136 @@
+#ifndef COUNTINGBLOOMFILTER_HPP
+#define COUNTINGBLOOMFILTER_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <functional>
+
+using namespace std;
+
+// ==========================================
+// CLASS: CountingBloomFilter
+// Description: Answers "is this passenger ID definitely absent?" without
+// walking the passenger list or the waitlist.
+// 1. 4-bit counters, two per byte; an ID bumps k of them (double hashing).
+// 2. Removing an ID decrements the same counters, so cancellations and
+//    waitlist promotions keep the filter exact (no false negatives).
+//    A counter that reaches 15 stays there (never decremented again).
+// 3. At least 10 counters per ID (rounded up to a power of two; k = 7,
+//    under 1% false positives); the owner rebuilds it twice as large once
+//    it holds more IDs than planned.
+// Counts how many lookups it answered and how many "maybe" answers turned
+// out to be wrong, for the metrics screen.
+// Maintained by the systems on add / remove / waitlist changes.
+// ==========================================
+class CountingBloomFilter {
+private:
+    static constexpr int HASHES = 7;
+    static constexpr int COUNTERS_PER_ID = 10;
+    static constexpr uint8_t SATURATED = 15;
+
+    vector<uint8_t> nibbles;  // counter i = nibble (i & 1) of byte i >> 1
+    size_t mask = 0;          // counter count - 1 (power of two)
+    size_t capacity = 0;      // IDs planned for
+    size_t items = 0;         // IDs currently held (with repeats)
+
+    // Statistics (kept across rebuilds)
+    long long lookups = 0;
+    long long definiteMisses = 0;  // Answered "absent" -> list walk skipped
+    long long falsePositives = 0;  // Answered "maybe", the walk found nothing
+
+    uint8_t counter(size_t i) const { return (nibbles[i >> 1] >> ((i & 1) * 4)) & 0xF; }
+    void setCounter(size_t i, uint8_t v) {
+        int shift = (i & 1) * 4;
+        nibbles[i >> 1] = (uint8_t)((nibbles[i >> 1] & ~(0xF << shift)) | (v << shift));
+    }
+
+    // Function: k counter positions from one string hash (h1 + i * h2)
+    template <typename F>
+    void forEachCounter(const string& id, F f) const {
+        uint64_t h = hash<string>()(id);
+        uint64_t h1 = h;
+        uint64_t h2 = ((h >> 32) | (h << 32)) * 0x9E3779B97F4A7C15ULL | 1; // odd step
+        for (int i = 0; i < HASHES; i++) f((size_t)((h1 + i * h2) & mask));
+    }
+
+public:
+    CountingBloomFilter() { reset(1024); }
+
+    // Function: Empty filter sized for 'expectedIDs'
+    void reset(size_t expectedIDs) {
+        capacity = expectedIDs < 64 ? 64 : expectedIDs;
+        size_t counters = 1;
+        while (counters < capacity * COUNTERS_PER_ID) counters <<= 1;
+        nibbles.assign(counters / 2, 0);
+        mask = counters - 1;
+        items = 0;
+    }
+
+    void add(const string& id) {
+        forEachCounter(id, [&](size_t i) {
+            uint8_t c = counter(i);
+            if (c < SATURATED) setCounter(i, c + 1);
+        });
+        items++;
+    }
+
+    // Function: Remove an ID that was add()-ed before
+    void remove(const string& id) {
+        forEachCounter(id, [&](size_t i) {
+            uint8_t c = counter(i);
+            if (c > 0 && c < SATURATED) setCounter(i, c - 1);
+        });
+        if (items > 0) items--;
+    }
+
+    // Function: false = the ID is certainly not held
+    bool mayContain(const string& id) {
+        lookups++;
+        bool maybe = probe(id);
+        if (!maybe) definiteMisses++;
+        return maybe;
+    }
+
+    // Function: Same answer as mayContain, left out of the statistics
+    // (for callers that cannot tell a false positive from a hit cheaply)
+    bool probe(const string& id) const {
+        bool maybe = true;
+        forEachCounter(id, [&](size_t i) {
+            if (maybe && counter(i) == 0) maybe = false;
+        });
+        return maybe;
+    }
+
+    // The caller walked the list after a "maybe" and found nothing
+    void noteFalsePositive() { falsePositives++; }
+
+    // True once the filter holds more IDs than it was sized for
+    bool needsGrow() const { return items > capacity; }
+    size_t plannedIDs() const { return capacity; }
+
+    // ==========================================
+    // METRICS
+    // ==========================================
+    size_t size() const { return items; }
+    size_t counters() const { return mask + 1; }
+    size_t memoryBytes() const { return nibbles.size(); }
+    int hashCount() const { return HASHES; }
+    long long lookupCount() const { return lookups; }
+    long long definiteMissCount() const { return definiteMisses; }
+    long long falsePositiveCount() const { return falsePositives; }
+
+    // Theory: (1 - e^(-k n / m))^k for the current fill
+    double expectedFPR() const {
+        return pow(1.0 - exp(-(double)HASHES * items / (double)counters()), HASHES);
+    }
+
+    // Measured: wrong "maybe" answers among lookups of absent IDs
+    double observedFPR() const {
+        long long negatives = definiteMisses + falsePositives;
+        return negatives > 0 ? (double)falsePositives / negatives : 0.0;
+    }
+};
+
+#endif
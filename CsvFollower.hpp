@@ -0,0 +1,230 @@
+#ifndef CSVFOLLOWER_HPP
+#define CSVFOLLOWER_HPP
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <functional>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#endif
+
+#include "Logger.hpp"
+
+using namespace std;
+
+// ==========================================
+// CLASS: CsvFollower
+// Description: "tail -F" for the booking CSV. Remembers how many bytes of
+// the file it has consumed and hands out only complete lines appended
+// since the last call.
+// 1. A trailing line without '\n' is kept back until its end arrives.
+// 2. Truncation (file shorter than what was consumed): start again at
+//    byte 0 of the same file.
+// 3. Rotation (the path now names a different file): finish the old file,
+//    then open the new one from the start.
+// The first line of every file (the header) is skipped.
+// wait() sleeps on inotify (Linux: file modified / moved / deleted, or a
+// file created in its directory); elsewhere it simply sleeps, so the
+// follower falls back to polling.
+// ==========================================
+class CsvFollower {
+private:
+    string path;
+    int fd = -1;
+    dev_t fileDev = 0;
+    ino_t fileIno = 0;
+    long long offset = 0;     // Bytes of the open file consumed (partial line included)
+    string partial;           // Tail of the file after its last '\n'
+    bool headerPending = true;
+    int notifyFd = -1;
+    int fileWatch = -1;
+    int dirWatch = -1;
+    atomic<long long> truncations{0};
+    atomic<long long> rotations{0};
+
+    static string dirOf(const string& file) {
+        size_t slash = file.find_last_of('/');
+        if (slash == string::npos) return ".";
+        return slash == 0 ? "/" : file.substr(0, slash);
+    }
+
+    void restartFile() {
+        offset = 0;
+        partial.clear();
+        headerPending = true;
+    }
+
+    bool openFile() {
+        fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+        struct stat st;
+        fstat(fd, &st);
+        fileDev = st.st_dev;
+        fileIno = st.st_ino;
+        restartFile();
+#ifdef __linux__
+        if (notifyFd >= 0) {
+            if (fileWatch >= 0) inotify_rm_watch(notifyFd, fileWatch);
+            fileWatch = inotify_add_watch(notifyFd, path.c_str(), IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+        }
+#endif
+        return true;
+    }
+
+    void closeFile() {
+        if (fd >= 0) ::close(fd);
+        fd = -1;
+    }
+
+    // Read the open file from 'offset' to its end, cutting complete lines
+    void drain(vector<string>& lines) {
+        static thread_local char buf[64 * 1024];
+        while (true) {
+            ssize_t n = pread(fd, buf, sizeof(buf), offset);
+            if (n <= 0) return;
+            offset += n;
+            const char* p = buf;
+            const char* end = buf + n;
+            while (p < end) {
+                const char* nl = (const char*)memchr(p, '\n', end - p);
+                if (nl == nullptr) {
+                    partial.append(p, end - p);
+                    break;
+                }
+                partial.append(p, nl - p);
+                if (headerPending) headerPending = false;
+                else if (!partial.empty()) lines.push_back(partial);
+                partial.clear();
+                p = nl + 1;
+            }
+        }
+    }
+
+public:
+    CsvFollower() {}
+    ~CsvFollower() { close(); }
+
+    CsvFollower(const CsvFollower&) = delete;
+    CsvFollower& operator=(const CsvFollower&) = delete;
+
+    // Function: Follow 'file' from its first line. The file may not exist
+    // yet; it is picked up once it appears.
+    bool open(const string& file) {
+        close();
+        path = file;
+#ifdef __linux__
+        notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (notifyFd >= 0) dirWatch = inotify_add_watch(notifyFd, dirOf(path).c_str(), IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM);
+#endif
+        return openFile();
+    }
+
+    void close() {
+        closeFile();
+        if (notifyFd >= 0) ::close(notifyFd);
+        notifyFd = fileWatch = dirWatch = -1;
+    }
+
+    bool usesInotify() const { return notifyFd >= 0; }
+    long long consumed() const { return offset; }
+    long long truncated() const { return truncations.load(); }
+    long long rotated() const { return rotations.load(); }
+
+    // Function: Append the complete lines written since the last call;
+    // returns how many
+    int readLines(vector<string>& lines) {
+        size_t before = lines.size();
+        if (fd < 0 && !openFile()) return 0;
+
+        struct stat named;
+        bool replaced = stat(path.c_str(), &named) == 0 && (named.st_ino != fileIno || named.st_dev != fileDev);
+
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size < offset) {
+            truncations++;
+            Log::warn() << ">> [Follow] " << path << " was truncated; reading it again from the start.";
+            restartFile();
+        }
+        drain(lines);
+
+        if (replaced) {
+            rotations++;
+            if (!partial.empty()) Log::warn() << ">> [Follow] Incomplete last line of the rotated file dropped.";
+            closeFile();
+            if (openFile()) drain(lines);
+        }
+        return (int)(lines.size() - before);
+    }
+
+    // Function: Sleep until the file (or its directory) changes, or
+    // 'timeoutMs' passes. False on timeout.
+    bool wait(int timeoutMs) {
+#ifdef __linux__
+        if (notifyFd >= 0) {
+            pollfd p = { notifyFd, POLLIN, 0 };
+            if (::poll(&p, 1, timeoutMs) <= 0) return false;
+            char events[4096];
+            while (::read(notifyFd, events, sizeof(events)) > 0) {} // Only "something changed" matters
+            return true;
+        }
+#endif
+        this_thread::sleep_for(chrono::milliseconds(timeoutMs));
+        return true;
+    }
+};
+
+// ==========================================
+// CLASS: CsvFollowThread
+// Description: Runs a CsvFollower on a background thread and hands every
+// batch of new lines to the owner's handler as soon as they are read,
+// on this thread. The handler locks whatever guards the systems.
+// 'seenAt' is when the follower woke up (inotify event, or poll tick).
+// ==========================================
+class CsvFollowThread {
+public:
+    typedef chrono::steady_clock Clock;
+    typedef function<void(const vector<string>& lines, Clock::time_point seenAt)> LineHandler;
+
+private:
+    CsvFollower follower;
+    thread worker;
+    LineHandler onLines;
+    atomic<bool> running{false};
+
+    void followLoop() {
+        vector<string> lines;
+        while (running.load()) {
+            follower.wait(200); // Timeout: also re-checks when an event was missed
+            Clock::time_point seenAt = Clock::now();
+            lines.clear();
+            if (follower.readLines(lines) > 0) onLines(lines, seenAt);
+        }
+    }
+
+public:
+    ~CsvFollowThread() { stop(); }
+
+    // The follower itself: open it and read the existing rows before start()
+    CsvFollower& reader() { return follower; }
+
+    void start(const LineHandler& handler) {
+        if (running.exchange(true)) return;
+        onLines = handler;
+        worker = thread(&CsvFollowThread::followLoop, this);
+    }
+
+    void stop() {
+        if (running.exchange(false)) worker.join();
+    }
+};
+
+#endif
@@ -0,0 +1,312 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <random>
+#include <cstdlib>
+#include <cstdio>
+
+#include "FlightCommon.hpp"
+#include "Timer.hpp"
+
+using namespace std;
+
+// ==========================================
+// TOOL: Synthetic Passenger Dataset Generator
+// Description: Writes large CSV files with the same schema as
+// flight_passenger_data.csv (PassengerID,Name,SeatRow,SeatColumn,Class).
+// Key Features:
+// 1. Streams rows straight to disk (memory use does not grow with --records).
+// 2. Rows are only ever paired with a class that passes validateSeatClass().
+// 3. Seat collisions and duplicate IDs are injected at configurable rates.
+// 4. Fixed seed -> identical output on every run.
+//
+// Build: g++ -std=c++17 -O2 DataGenerator.cpp -o datagen
+// Usage: datagen --records 1000000 --rows 200 --out big.csv
+// ==========================================
+
+struct GeneratorConfig {
+    string outFile = "generated_passengers.csv";
+    long long records = 1000000;  // Total rows across all flights
+    int flights = 1;              // One output file per flight
+    string layoutFile = "";       // Aircraft layout (default: built-in narrow-body)
+    int rows = 0;                 // Rows on the aircraft (0 = rows of the layout)
+    double firstPct = 10.0;       // Class mix (same ratio as the shipped dataset)
+    double businessPct = 23.5;
+    double economyPct = 66.5;
+    double collisionRate = 0.05;  // Chance a row re-uses an already booked seat
+    double duplicateRate = 0.01;  // Chance a row re-uses an earlier PassengerID
+    unsigned long long seed = 42;
+    long long startID = 100000;
+};
+
+static const char* FIRST_NAMES[] = {
+    "Alice", "Bob", "Carol", "David", "Eve", "Frank", "Grace", "Henry", "Ivy", "Jack",
+    "Kate", "Leo", "Mia", "Noah", "Olivia", "Paul", "Quinn", "Ryan", "Sara", "Tom"
+};
+static const char* LAST_NAMES[] = {
+    "Anderson", "Brown", "Davis", "Garcia", "Harris", "Jackson", "Johnson", "Jones", "Martin",
+    "Martinez", "Miller", "Rodriguez", "Smith", "Taylor", "Thomas", "White", "Williams", "Wilson"
+};
+static const int FIRST_COUNT = sizeof(FIRST_NAMES) / sizeof(FIRST_NAMES[0]);
+static const int LAST_COUNT = sizeof(LAST_NAMES) / sizeof(LAST_NAMES[0]);
+
+static const string CLASS_NAMES[3] = { "First", "Business", "Economy" };
+
+// ==========================================
+// HELPER: Class Zones
+// Rows are bucketed by asking validateSeatClass() directly, so the generator
+// can never drift away from the rules the systems enforce on load.
+// ==========================================
+struct ClassZone {
+    int* rows = nullptr;   // Rows that accept this class
+    int rowCount = 0;
+    long long seatCount = 0;      // rowCount * columns (blocked seats included)
+    long long sellableCount = 0;  // Seats that are not blocked by the layout
+};
+
+inline bool zoneSeatBlocked(const ClassZone& zone, long long seat) {
+    return FlightGlobal::layout().isBlocked(zone.rows[seat / FlightGlobal::cols()], (int)(seat % FlightGlobal::cols()));
+}
+
+void buildZones(ClassZone zones[3], int totalRows) {
+    for (int c = 0; c < 3; c++) {
+        zones[c].rows = new int[totalRows];
+        zones[c].rowCount = 0;
+        for (int r = 1; r <= totalRows; r++) {
+            if (validateSeatClass(r, CLASS_NAMES[c])) zones[c].rows[zones[c].rowCount++] = r;
+        }
+        zones[c].seatCount = (long long)zones[c].rowCount * FlightGlobal::cols();
+        zones[c].sellableCount = 0;
+        for (long long seat = 0; seat < zones[c].seatCount; seat++) {
+            if (!zoneSeatBlocked(zones[c], seat)) zones[c].sellableCount++;
+        }
+    }
+}
+
+void freeZones(ClassZone zones[3]) {
+    for (int c = 0; c < 3; c++) delete[] zones[c].rows;
+}
+
+// ==========================================
+// HELPER: Command Line Parsing
+// ==========================================
+void printUsage() {
+    cout << "Usage: datagen [options]\n"
+         << "  --out FILE             Output CSV (flight number is appended when --flights > 1)\n"
+         << "  --records N            Total rows to generate (default 1000000)\n"
+         << "  --flights N            Number of flights / output files (default 1)\n"
+         << "  --layout FILE|PRESET   Aircraft layout file, or narrow-33 / wide-343 (default narrow-33)\n"
+         << "  --rows N               Rows per aircraft (default: rows of the layout)\n"
+         << "  --mix F,B,E            Class mix in percent (default 10,23.5,66.5)\n"
+         << "  --collision-rate X     Fraction of rows aimed at a taken seat (default 0.05)\n"
+         << "  --duplicate-rate X     Fraction of rows re-using an earlier ID (default 0.01)\n"
+         << "  --seed N               RNG seed (default 42)\n"
+         << "  --start-id N           First PassengerID (default 100000)\n";
+}
+
+bool parseArgs(int argc, char* argv[], GeneratorConfig& cfg) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--help" || arg == "-h") { printUsage(); return false; }
+        if (i + 1 >= argc) {
+            cerr << ">> [Error] Missing value for " << arg << endl;
+            return false;
+        }
+        string val = argv[++i];
+        try {
+            if (arg == "--out") cfg.outFile = val;
+            else if (arg == "--records") cfg.records = stoll(val);
+            else if (arg == "--flights") cfg.flights = stoi(val);
+            else if (arg == "--rows") cfg.rows = stoi(val);
+            else if (arg == "--layout") cfg.layoutFile = val;
+            else if (arg == "--collision-rate") cfg.collisionRate = stod(val);
+            else if (arg == "--duplicate-rate") cfg.duplicateRate = stod(val);
+            else if (arg == "--seed") cfg.seed = stoull(val);
+            else if (arg == "--start-id") cfg.startID = stoll(val);
+            else if (arg == "--mix") {
+                if (sscanf(val.c_str(), "%lf,%lf,%lf", &cfg.firstPct, &cfg.businessPct, &cfg.economyPct) != 3) {
+                    cerr << ">> [Error] --mix expects three comma separated numbers." << endl;
+                    return false;
+                }
+            } else {
+                cerr << ">> [Error] Unknown option " << arg << endl;
+                printUsage();
+                return false;
+            }
+        } catch (...) {
+            cerr << ">> [Error] Invalid value '" << val << "' for " << arg << endl;
+            return false;
+        }
+    }
+
+    if (!cfg.layoutFile.empty()) {
+        AircraftLayout layout;
+        if (!layoutPreset(cfg.layoutFile, layout) && !loadLayoutFile(cfg.layoutFile, layout)) {
+            cerr << ">> [Error] Could not load layout " << cfg.layoutFile << endl;
+            return false;
+        }
+        FlightGlobal::setLayout(layout);
+    }
+    if (cfg.rows == 0) cfg.rows = FlightGlobal::totalRows();
+
+    if (cfg.records < 1 || cfg.flights < 1 || cfg.rows < 1) {
+        cerr << ">> [Error] --records, --flights and --rows must be positive." << endl;
+        return false;
+    }
+    if (cfg.firstPct < 0 || cfg.businessPct < 0 || cfg.economyPct < 0 ||
+        cfg.firstPct + cfg.businessPct + cfg.economyPct <= 0) {
+        cerr << ">> [Error] Class mix must be non-negative and not all zero." << endl;
+        return false;
+    }
+    return true;
+}
+
+string flightFileName(const GeneratorConfig& cfg, int flight) {
+    if (cfg.flights == 1) return cfg.outFile;
+    string base = cfg.outFile;
+    string ext = "";
+    size_t dot = base.find_last_of('.');
+    size_t slash = base.find_last_of("/\\");
+    if (dot != string::npos && (slash == string::npos || slash < dot)) {
+        ext = base.substr(dot);
+        base = base.substr(0, dot);
+    }
+    char suffix[16];
+    snprintf(suffix, sizeof(suffix), "_F%03d", flight + 1);
+    return base + suffix + ext;
+}
+
+// ==========================================
+// CORE: Generate One Flight
+// Seats are handed out with a per-class cursor (seat k of the zone = row k/COLS,
+// column k%COLS), so "which seats are already taken" is simply [0, cursor) and
+// nothing has to be remembered per row.
+// ==========================================
+long long generateFlight(const GeneratorConfig& cfg, ClassZone zones[3], const string& fileName,
+                         long long recordCount, long long& nextID, mt19937_64& rng) {
+    ofstream out;
+    static char ioBuffer[1 << 20];
+    out.rdbuf()->pubsetbuf(ioBuffer, sizeof(ioBuffer));
+    out.open(fileName, ios::out | ios::binary);
+    if (!out.is_open()) {
+        cerr << ">> [Error] Could not open " << fileName << " for writing." << endl;
+        return -1;
+    }
+    out << "PassengerID,Name,SeatRow,SeatColumn,Class\r\n";
+
+    // Classes with no rows on this aircraft are dropped from the mix
+    double weights[3] = { cfg.firstPct, cfg.businessPct, cfg.economyPct };
+    for (int c = 0; c < 3; c++) if (zones[c].sellableCount == 0) weights[c] = 0;
+    discrete_distribution<int> pickClass(weights, weights + 3);
+    uniform_real_distribution<double> chance(0.0, 1.0);
+    uniform_int_distribution<int> pickFirst(0, FIRST_COUNT - 1);
+    uniform_int_distribution<int> pickLast(0, LAST_COUNT - 1);
+
+    long long cursor[3] = { 0, 0, 0 };
+    long long assigned[3] = { 0, 0, 0 };
+    long long flightFirstID = nextID;
+    long long collisions = 0, duplicates = 0;
+    string line;
+    line.reserve(64);
+
+    for (long long n = 0; n < recordCount; n++) {
+        int cls = pickClass(rng);
+        ClassZone& zone = zones[cls];
+
+        // 1. Seat: fresh seat unless a collision is requested or the zone is full
+        //    (blocked seats are skipped, the systems would reject them)
+        while (cursor[cls] < zone.seatCount && zoneSeatBlocked(zone, cursor[cls])) cursor[cls]++;
+        long long seat;
+        bool collide = (assigned[cls] > 0 && chance(rng) < cfg.collisionRate) || cursor[cls] >= zone.seatCount;
+        if (collide) {
+            long long taken = cursor[cls] < zone.seatCount ? cursor[cls] : zone.seatCount;
+            do {
+                seat = uniform_int_distribution<long long>(0, taken - 1)(rng);
+            } while (zoneSeatBlocked(zone, seat));
+            collisions++;
+        } else {
+            seat = cursor[cls]++;
+            assigned[cls]++;
+        }
+        int row = zone.rows[seat / FlightGlobal::cols()];
+        int col = (int)(seat % FlightGlobal::cols());
+
+        // 2. ID: re-use an earlier ID of this flight at the duplicate rate
+        long long id;
+        if (nextID > flightFirstID && chance(rng) < cfg.duplicateRate) {
+            id = uniform_int_distribution<long long>(flightFirstID, nextID - 1)(rng);
+            duplicates++;
+        } else {
+            id = nextID++;
+        }
+
+        // 3. Emit
+        line.clear();
+        line += to_string(id);
+        line += ',';
+        line += FIRST_NAMES[pickFirst(rng)];
+        line += ' ';
+        line += LAST_NAMES[pickLast(rng)];
+        line += ',';
+        line += to_string(row);
+        line += ',';
+        line += FlightGlobal::getColName(col);
+        line += ',';
+        line += CLASS_NAMES[cls];
+        line += "\r\n";
+        out.write(line.data(), (streamsize)line.size());
+
+        if ((n + 1) % 10000000 == 0) {
+            cerr << ">> [Progress] " << fileName << ": " << (n + 1) << " rows" << endl;
+        }
+    }
+    out.close();
+
+    cout << ">> " << fileName << ": " << recordCount << " rows, "
+         << collisions << " seat collisions, " << duplicates << " duplicate IDs." << endl;
+    return recordCount;
+}
+
+// ==========================================
+// MAIN FUNCTION
+// ==========================================
+int main(int argc, char* argv[]) {
+    GeneratorConfig cfg;
+    if (!parseArgs(argc, argv, cfg)) return 1;
+
+    ClassZone zones[3];
+    buildZones(zones, cfg.rows);
+    cout << ">> Aircraft: " << cfg.rows << " rows (" << zones[0].rowCount << " First, "
+         << zones[1].rowCount << " Business, " << zones[2].rowCount << " Economy)" << endl;
+
+    // The class mix needs at least one class with sellable seats
+    double mix[3] = { cfg.firstPct, cfg.businessPct, cfg.economyPct };
+    bool sellable = false;
+    for (int c = 0; c < 3; c++) {
+        if (zones[c].sellableCount > 0 && mix[c] > 0) sellable = true;
+    }
+    if (!sellable) {
+        cerr << ">> [Error] No class in the mix has a sellable seat on this aircraft." << endl;
+        freeZones(zones);
+        return 1;
+    }
+
+    mt19937_64 rng(cfg.seed);
+    long long nextID = cfg.startID;
+    long long written = 0;
+
+    Timer t;
+    t.start();
+    for (int f = 0; f < cfg.flights; f++) {
+        // Spread the remainder over the first flights
+        long long share = cfg.records / cfg.flights + (f < cfg.records % cfg.flights ? 1 : 0);
+        long long n = generateFlight(cfg, zones, flightFileName(cfg, f), share, nextID, rng);
+        if (n < 0) { freeZones(zones); return 1; }
+        written += n;
+    }
+    t.stop();
+
+    cout << ">> Generated " << written << " rows in " << t.getDurationInMilliseconds() << " ms." << endl;
+    freeZones(zones);
+    return 0;
+}
@@ -0,0 +1,90 @@
+#ifndef DATALOADER_HPP
+#define DATALOADER_HPP
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "FlightCommon.hpp"
+#include "StaticFlight.hpp"
+
+using namespace std;
+
+// Highest numeric PassengerID seen so far (used to auto-generate new IDs)
+inline long long globalMaxID = 0;
+
+// Function: Book one CSV row (PassengerID,Name,Row,Column,Class).
+// False if the row is not a passenger row (header, blank, bad number).
+template <typename System>
+bool ingestRow(StaticFlight<System>& flight, const string& line) {
+    stringstream ss(line);
+    string id, name, rowStr, col, fclass;
+
+    getline(ss, id, ',');
+    getline(ss, name, ',');
+    getline(ss, rowStr, ',');
+    getline(ss, col, ',');
+    getline(ss, fclass, ',');
+
+    if (!col.empty() && col.back() == '\r') col.pop_back();
+    if (!fclass.empty() && fclass.back() == '\r') fclass.pop_back();
+
+    if (id.empty() || rowStr.empty()) return false;
+    try {
+        // [NEW] Track the highest ID
+        long long currentIdVal = stoll(id); // Convert string ID to number
+        if (currentIdVal > globalMaxID) {
+            globalMaxID = currentIdVal;
+        }
+
+        flight.addPassenger(id, name, stoi(rowStr), col, fclass);
+        return true;
+    } catch (...) {}
+    return false;
+}
+
+// ==========================================
+// FILE I/O: CSV Loader
+// Templated on the concrete system so bulk ingest goes through
+// StaticFlight (direct calls). Passing a FlightSystem* still works and
+// uses the normal virtual path.
+// Returns the number of rows handed to the system.
+// ==========================================
+template <typename System>
+int loadData(System* sys, string filename) {
+    ifstream file(filename);
+    if (!file.is_open()) {
+        cout << "Error: Could not open file " << filename << endl;
+        return 0;
+    }
+    StaticFlight<System> flight(*sys);
+
+    string line;
+    getline(file, line); // Skip Header
+
+    int count = 0;
+    while (getline(file, line)) {
+        if (ingestRow(flight, line)) count++;
+    }
+    Log::flush(); // Status lines of this file come before the summary
+    cout << ">> Loaded " << count << " passengers into " << filename << endl;
+    file.close();
+    return count;
+}
+
+// Function: Book rows already read from the CSV (follow mode: the lines a
+// CsvFollower returned). Returns the number of rows handed to the system.
+template <typename System>
+int ingestLines(System* sys, const vector<string>& lines) {
+    StaticFlight<System> flight(*sys);
+    int count = 0;
+    for (const string& line : lines) {
+        if (ingestRow(flight, line)) count++;
+    }
+    Log::flush();
+    return count;
+}
+
+#endif
@@ -2,11 +2,24 @@
 #define FLIGHTCOMMON_HPP
 
 #include <string>
+#include <vector>
+#include <unordered_set>
 #include <iostream>
 #include <iomanip>
 #include <limits> // For numeric_limits
 #include <cmath>  // For ceil
 
+#include "AircraftLayout.hpp" // Cabin description (columns, aisles, class zones)
+#include "SeatOccupancy.hpp"  // Occupancy bitmasks (free-seat finder)
+#include "NameIndex.hpp"      // Prefix / fuzzy name search
+#include "RowBucketIndex.hpp" // Per-row buckets (row / class / column queries)
+#include "CountingBloomFilter.hpp" // Fast "ID not on this flight" answers
+#include "Logger.hpp"         // Buffered status lines (levels, quiet mode)
+#include "WaitlistHeap.hpp"   // Priority waitlist order (class, tier, arrival)
+#include "SeatSnapshot.hpp"   // Immutable seat-grid views for concurrent readers
+#include "FlightStats.hpp"    // Live counters (seats / waitlist per class)
+#include "ChangeFeed.hpp"     // Event stream of bookings / cancellations / waitlist moves
+
 using namespace std;
 
 // ==========================================
@@ -38,6 +51,7 @@ struct WaitlistNode {
     int row;      // Remember the row they wanted
     string col;   // Remember the column they wanted
     string flightClass;
+    int priority = WAIT_FARE_PAID; // WaitPriority (used by the priority waitlist mode)
     WaitlistNode* next;
 };;
 
@@ -48,16 +62,26 @@ struct WaitlistNode {
 namespace FlightGlobal {
     
     // --- Constant Configuration (Constants) ---
-    const int COLS = 6;             // Changed back to 6 columns (A-F)
     const int COL_WIDTH = 15;       // Width 15, just enough to show the name without breaking the screen layout
     const int ROWS_PER_PAGE = 15;   // Show 15 rows per page
     const int MANIFEST_PER_PAGE = 15;
     const int DEFAULT_MAX_ROWS = 60; // A normal plane has about 50-60 rows
 
+    // --- Active Aircraft Layout ---
+    // Set once at startup (before any system is created), read everywhere else.
+    inline AircraftLayout& layout() {
+        static AircraftLayout active = AircraftLayout::fromFixed<NarrowBody33>("Narrow-body 3-3");
+        return active;
+    }
+    inline void setLayout(const AircraftLayout& l) { layout() = l; }
+
+    inline int cols() { return layout().columnCount(); } // Seats per row (was fixed at 6)
+    inline int totalRows() { return layout().totalRows; }
+
     // --- Helper Functions (Helpers) ---
 
     inline string getColString(int index) {
-        if (index < 0 || index >= COLS) return "?";
+        if (index < 0 || index >= cols()) return "?";
         char c = 'A' + index;
         return string(1, c);
     }
@@ -69,15 +93,28 @@ namespace FlightGlobal {
     inline int getColIndex(string col) {
         if (col.empty()) return -1;
         char c = toupper(col[0]);
-        if (c >= 'A' && c <= 'F') return c - 'A'; // Only allow A-F
+        if (c >= 'A' && c < 'A' + cols()) return c - 'A'; // Only columns on this aircraft
         return -1;
     }
 
+    // e.g. "A-F"
+    inline string colRangeText() { return getColName(0) + "-" + getColName(cols() - 1); }
+
     // 3. Format Name Display (Handle empty seats)
     inline string formatName(string name) {
         if (name == "" || name == "EMPTY") return "---";
         return name;
     }
+
+    // 4. Seat Map Column Header ("[A] [B] [C]    [D] ...", gap at each aisle)
+    inline void printSeatMapHeader() {
+        cout << "      ";
+        for (int c = 0; c < cols(); c++) {
+            cout << left << setw(COL_WIDTH) << ("[" + getColName(c) + "]");
+            if (layout().aisleAfter(c) && c < cols() - 1) cout << "    ";
+        }
+        cout << endl;
+    }
 }
 
 // ==========================================
@@ -122,26 +159,242 @@ public:
     // When the flight is full, call this function to add to the Singly Linked List
     virtual void addToWaitlist(string id, string name, int row, string col, string fclass) = 0;
 
+    // [Feature] Auto-Assign Booking (Best Available Seat)
+    // Books the first free seat of the class, preferring Window/Aisle (SeatPreference),
+    // found with the occupancy bitmasks instead of asking for a row/column.
+    // Cost: O(rows / 64) summary words + one ctz, no seat-by-seat scan
+    virtual bool autoAssignPassenger(string id, string name, string fclass, int pref) {
+        SeatOccupancy* occupancy = seatOccupancy();
+        if (occupancy == nullptr) {
+            cout << ">> Feature not available." << endl;
+            return false;
+        }
+        int cls = classCode(fclass);
+        int row, cIndex;
+        if (cls == CLASS_NONE || !occupancy->findFree(cls, pref, row, cIndex)) {
+            Log::warn() << ">> [Auto-Assign] No free " << fclass << " seat left.";
+            return false;
+        }
+        Log::info() << ">> [Auto-Assign] Best available " << seatPreferenceName(pref) << " seat: " << row << FlightGlobal::getColName(cIndex);
+        return addPassenger(id, name, row, FlightGlobal::getColName(cIndex), fclass);
+    }
+
+    // [Feature] Group Booking (All-or-Nothing)
+    // Seats ids[i]/names[i] together: K adjacent seats in one aisle block,
+    // or adjacent rows if no single row fits. Either every member is seated or none is.
+    // Everything is checked before the first seat is written, so the
+    // commit step cannot fail half way.
+    virtual bool addGroup(const vector<string>& ids, const vector<string>& names, string fclass) {
+        SeatOccupancy* occupancy = seatOccupancy();
+        if (occupancy == nullptr) {
+            cout << ">> Feature not available." << endl;
+            return false;
+        }
+        int k = (int)ids.size();
+        int cls = classCode(fclass);
+        if (k == 0 || names.size() != ids.size() || cls == CLASS_NONE) {
+            cout << ">> [Group] Invalid group request." << endl;
+            return false;
+        }
+
+        // 1. IDs must be unique inside the group and new to the flight
+        unordered_set<string> groupIDs(ids.begin(), ids.end());
+        if ((int)groupIDs.size() != k) {
+            cout << ">> [Group] The group contains the same ID twice." << endl;
+            return false;
+        }
+        string taken = findSeatedID(groupIDs);
+        if (!taken.empty()) {
+            cout << ">> [Group] Passenger ID " << taken << " already exists or has a seat on hold." << endl;
+            return false;
+        }
+
+        // 2. Find K seats together (occupancy bitmasks)
+        vector<pair<int, int>> seats;
+        if (!occupancy->findGroupSeats(cls, k, seats)) {
+            cout << ">> [Group] No block of " << k << " adjacent " << fclass << " seats available." << endl;
+            return false;
+        }
+
+        // 3. Commit all seats; if any booking fails, cancel the members
+        // already seated so the group is booked all together or not at all
+        for (int i = 0; i < k; i++) {
+            if (!addPassenger(ids[i], names[i], seats[i].first, FlightGlobal::getColName(seats[i].second), fclass)) {
+                for (int j = 0; j < i; j++) removePassenger(ids[j]);
+                cout << ">> [Group] Booking " << ids[i] << " failed, group not seated." << endl;
+                return false;
+            }
+        }
+        cout << ">> [Group] " << k << " passengers seated together starting at "
+             << seats[0].first << FlightGlobal::getColName(seats[0].second) << "." << endl;
+        return true;
+    }
+
+    // [Feature] Name Search (Prefix + Fuzzy)
+    // Top-K passengers (seated and waitlisted) whose name matches a partial or misspelled query.
+    virtual vector<NameMatch> searchByName(const string& /*query*/, int /*k*/) {
+        cout << ">> Feature not available." << endl;
+        return vector<NameMatch>();
+    }
+
+    // [Feature] Free seats left in a class (CLASS_FIRST / CLASS_BUSINESS / CLASS_ECONOMY)
+    // Returns -1 if the system does not track occupancy.
+    virtual int countFreeSeats(int cls) {
+        SeatOccupancy* occupancy = seatOccupancy();
+        return occupancy == nullptr ? -1 : occupancy->countFree(cls);
+    }
+
+    // [Feature] Range Queries (Boarding by Zone)
+    // Seated passengers in rows fromRow..toRow, optionally one class
+    // (CLASS_NONE = any) and one column index (-1 = any), in seat order.
+    virtual vector<Passenger*> queryPassengers(int /*fromRow*/, int /*toRow*/, int /*cls*/, int /*col*/) {
+        cout << ">> Feature not available." << endl;
+        return vector<Passenger*>();
+    }
+
+    // [Feature] Batch Cancellation
+    // Cancels every listed ID and returns how many were removed.
+    // Fallback: one removePassenger call per ID. The systems override it with a
+    // single pass that also drops listed IDs from the waitlist, then promotes
+    // waitlisted passengers once for the whole batch.
+    virtual int removePassengers(const vector<string>& ids) {
+        int removed = 0;
+        for (const string& id : ids) removed += removePassenger(id) ? 1 : 0;
+        return removed;
+    }
+
+    // [Feature] Batch Lookup
+    // result[i] = passenger with ids[i], or nullptr. Waitlist hits are copies
+    // (seatRow 0, seatCol "WL") that stay valid until the next batch lookup.
+    virtual vector<Passenger*> searchPassengers(const vector<string>& ids) {
+        batchWaitlistHits.clear();
+        batchWaitlistHits.reserve(ids.size()); // No reallocation: pointers below stay valid
+        vector<Passenger*> result;
+        for (const string& id : ids) {
+            Passenger* p = searchPassenger(id);
+            if (p != nullptr && p->seatRow == 0) { // searchPassenger reuses one static object
+                batchWaitlistHits.push_back(*p);
+                p = &batchWaitlistHits.back();
+            }
+            result.push_back(p);
+        }
+        return result;
+    }
+
+    // [Feature] Waitlist Position
+    // 1-based place in line of a waitlisted ID, 0 if not waiting,
+    // -1 if the system does not track positions.
+    virtual int waitlistPosition(const string& /*id*/) { return -1; }
+
+    // [Feature] Waitlist Cancellation
+    // Removes a waiting passenger (no seat involved). False if not waiting.
+    virtual bool cancelWaitlist(const string& /*id*/) {
+        cout << ">> Feature not available." << endl;
+        return false;
+    }
+    // True if cancelWaitlist is implemented (asked before calling it quietly)
+    virtual bool supportsCancelWaitlist() const { return false; }
+
+    // [Feature] Priority Waitlist Mode
+    // On: cancellations promote the best waiter of the freed seat's class
+    // (fare-paid before standby, then arrival) instead of the queue head.
+    virtual bool setPriorityWaitlist(bool /*on*/) {
+        cout << ">> Feature not available." << endl;
+        return false;
+    }
+    virtual bool priorityWaitlist() const { return false; }
+
+    // [Feature] Standby Waitlist Entry
+    // Joins the waitlist behind every fare-paid waiter of the same class
+    // (only differs from addToWaitlist in priority mode).
+    virtual void addStandby(string id, string name, int row, string col, string fclass) {
+        addToWaitlist(id, name, row, col, fclass);
+    }
+
+    // [Feature] Seat Holds (Expiring Reservations)
+    // A hold keeps the seat out of sale for ttlSeconds; confirm books it,
+    // release (or expiry) frees it and hands it to the waitlist.
+    virtual bool holdSeat(string /*id*/, string /*name*/, int /*row*/, string /*col*/, string /*fclass*/, int /*ttlSeconds*/) {
+        cout << ">> Feature not available." << endl;
+        return false;
+    }
+    virtual bool confirmHold(const string& /*id*/) {
+        cout << ">> Feature not available." << endl;
+        return false;
+    }
+    virtual bool releaseHold(const string& /*id*/) {
+        cout << ">> Feature not available." << endl;
+        return false;
+    }
+    // Expires every hold that is due by now; returns how many expired
+    virtual int expireHolds() { return 0; }
+
+    // [Feature] Flight Statistics (Incremental Counters)
+    // Seated / held / free seats and waitlist depth per class, highest
+    // occupied row. O(1): the counters are updated on every change.
+    virtual bool flightStats(FlightStats& /*stats*/) {
+        cout << ">> Feature not available." << endl;
+        return false;
+    }
+
+    // [Feature] Read Snapshot (Copy-on-Write)
+    // Latest published seat grid; safe to read from other threads while
+    // bookings continue. nullptr if the system does not publish snapshots.
+    virtual shared_ptr<const SeatSnapshot> snapshot() const { return nullptr; }
+
+    // [Feature] Change Feed (Event Stream)
+    // Every booking, cancellation, waitlist join / leave and promotion, in
+    // order. Subscribe with a FeedCursor (or FeedFileWriter) from any thread.
+    // nullptr if the system does not publish changes.
+    virtual const ChangeFeed* changeFeed() const { return nullptr; }
+
+    // [Feature] ID Filter Metrics
+    // Counting Bloom filter over seated + waitlisted IDs, or nullptr if the
+    // system answers ID lookups without one.
+    virtual const CountingBloomFilter* idFilter() const { return nullptr; }
+
     // [Safety] Virtual Destructor
     // Ensure memory is correctly cleaned up when program closes (Avoid Memory Leak)
     virtual ~FlightSystem() {}
-};
 
-// Check if the seat row matches the passenger's ticket class
-bool validateSeatClass(int row, string fclass) {
-    // 1. First Class Zone (Rows 1-3)
-    if (row >= 1 && row <= 3) {
-        if (fclass != "First") return false;
-    }
-    // 2. Business Class Zone (Rows 4-10)
-    else if (row >= 4 && row <= 10) {
-        if (fclass != "Business") return false;
+protected:
+    vector<Passenger> batchWaitlistHits; // Waitlist results of the last searchPassengers call
+
+    // --- Storage Hooks (the shared features above only need these) ---
+
+    // Occupancy bitmasks of the seat grid, or nullptr if the system keeps none
+    // (auto-assign, group booking and free-seat counts are then unavailable).
+    virtual SeatOccupancy* seatOccupancy() { return nullptr; }
+
+    // First ID of 'ids' that already has a seat, or "" if none. Systems
+    // with seat holds also report held IDs (addPassenger rejects them).
+    // Fallback: one searchPassenger call per ID.
+    virtual string findSeatedID(const unordered_set<string>& ids) {
+        for (const string& id : ids) {
+            Passenger* p = searchPassenger(id);
+            if (p != nullptr && p->seatRow > 0) return id;
+        }
+        return "";
     }
-    // 3. Economy Class Zone (Rows 11+)
-    else if (row >= 11) {
-        if (fclass != "Economy") return false;
+
+    // Waitlisted passenger in the shape the lookups return: no seat (row 0),
+    // column "WL" and a " [WAITLIST]" tag on the name
+    static Passenger waitlistRecord(const string& id, const string& name, const string& fclass) {
+        Passenger hit;
+        hit.passengerID = id;
+        hit.name = name + " [WAITLIST]";
+        hit.seatRow = 0;
+        hit.seatCol = "WL";
+        hit.flightClass = fclass;
+        return hit;
     }
-    return true;
+};
+
+// Check if the seat row matches the passenger's ticket class
+// Zones come from the active aircraft layout (one table lookup per call);
+// the default layout keeps First = Rows 1-3, Business = 4-10, Economy = 11+.
+inline bool validateSeatClass(int row, string fclass) {
+    return FlightGlobal::layout().validate(row, classCode(fclass));
 }
 
 #endif
\ No newline at end of file
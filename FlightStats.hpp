@@ -0,0 +1,65 @@
+#ifndef FLIGHTSTATS_HPP
+#define FLIGHTSTATS_HPP
+
+#include <string>
+
+#include "AircraftLayout.hpp"
+#include "SeatOccupancy.hpp"
+
+using namespace std;
+
+// ==========================================
+// STRUCT: FlightStats
+// Description: Counters a dashboard polls (FlightSystem::flightStats).
+// Every number is kept up to date on each booking, cancellation, hold and
+// waitlist change, so reading them never walks the passengers.
+// Seat counts are per cabin zone; waitlist depth is per ticket class.
+// ==========================================
+struct FlightStats {
+    int seated[CLASS_COUNT] = { 0, 0, 0 };     // Passengers in seats
+    int held[CLASS_COUNT] = { 0, 0, 0 };       // Seats under a hold (not booked yet)
+    int freeSeats[CLASS_COUNT] = { 0, 0, 0 };  // Sellable seats nobody has taken
+    int waiting[CLASS_COUNT] = { 0, 0, 0 };    // Waitlist depth by ticket class
+    int waitingTotal = 0;                      // Whole waitlist (any class)
+    int highestRow = 0;                        // Highest row with a taken seat, 0 = none
+};
+
+// ==========================================
+// CLASS: WaitlistTally
+// Waitlist depth per ticket class. The systems call join() / leave() next
+// to every waitlist insert and removal.
+// ==========================================
+class WaitlistTally {
+private:
+    int byClass[CLASS_COUNT + 1] = { 0, 0, 0, 0 }; // Last slot: no valid class
+
+public:
+    void join(const string& fclass) { byClass[classCode(fclass)]++; }
+    void leave(const string& fclass) { byClass[classCode(fclass)]--; }
+
+    int count(int cls) const { return (cls >= 0 && cls <= CLASS_COUNT) ? byClass[cls] : 0; }
+    int total() const { return byClass[0] + byClass[1] + byClass[2] + byClass[CLASS_COUNT]; }
+
+    void clear() {
+        for (int c = 0; c <= CLASS_COUNT; c++) byClass[c] = 0;
+    }
+
+    // Function: Fill the waitlist part of 'stats'
+    void fill(FlightStats& stats) const {
+        for (int c = 0; c < CLASS_COUNT; c++) stats.waiting[c] = byClass[c];
+        stats.waitingTotal = total();
+    }
+};
+
+// Function: Fill the seat part of 'stats' from a system's occupancy bitmasks
+// ('held' = seats taken by holds rather than passengers, per class)
+inline void fillSeatStats(FlightStats& stats, const SeatOccupancy& occupancy, const int* held = nullptr) {
+    for (int c = 0; c < CLASS_COUNT; c++) {
+        stats.held[c] = held != nullptr ? held[c] : 0;
+        stats.freeSeats[c] = occupancy.countFree(c);
+        stats.seated[c] = occupancy.countTaken(c) - stats.held[c];
+    }
+    stats.highestRow = occupancy.highestTakenRow();
+}
+
+#endif
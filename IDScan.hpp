@@ -0,0 +1,127 @@
+#ifndef IDSCAN_HPP
+#define IDSCAN_HPP
+
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define IDSCAN_X86 1
+#endif
+
+using namespace std;
+
+// ==========================================
+// MODULE: IDScan
+// Description: Linear search over a dense array of 8-byte ID keys.
+// Each ID is packed into one uint64_t (IDs up to 8 characters are stored
+// as-is, longer ones are folded with a hash), so a scan compares 2 (SSE2)
+// or 4 (AVX2) IDs per instruction instead of one std::string at a time.
+// Still O(N): the array is read front to back until a key matches. A key
+// match is only a candidate - the caller confirms it against the real ID.
+// The kernel is chosen once at runtime from the CPU's features (AVX2 is
+// compiled per function, no global -mavx2 needed); setKernel() forces one
+// for benchmarks.
+// ==========================================
+namespace IDScan {
+
+    enum Kernel { SCALAR = 0, SSE2 = 1, AVX2 = 2 };
+
+    // Function: Pack an ID into its 8-byte key (callers store 0 for an empty
+    // slot; a match is always confirmed against the real ID)
+    inline uint64_t pack(const string& id) {
+        uint64_t key = 0;
+        memcpy(&key, id.data(), id.size() < 8 ? id.size() : 8);
+        if (id.size() > 8) key ^= (uint64_t)hash<string>()(id) | 1;
+        return key;
+    }
+
+    // --- Kernels: first i in [from, n) with keys[i] == key, or -1 ---
+
+    inline int scanScalar(const uint64_t* keys, int n, uint64_t key, int from) {
+        for (int i = from; i < n; i++) {
+            if (keys[i] == key) return i;
+        }
+        return -1;
+    }
+
+#ifdef IDSCAN_X86
+    // SSE2 has no 64-bit compare: two 32-bit compares, AND-ed with the
+    // neighbouring half, give "both halves equal" per 64-bit lane.
+    inline int scanSSE2(const uint64_t* keys, int n, uint64_t key, int from) {
+        int i = from;
+        __m128i k = _mm_set1_epi64x((long long)key);
+        for (; i + 4 <= n; i += 4) {
+            __m128i e0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(keys + i)), k);
+            __m128i e1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(keys + i + 2)), k);
+            e0 = _mm_and_si128(e0, _mm_shuffle_epi32(e0, _MM_SHUFFLE(2, 3, 0, 1)));
+            e1 = _mm_and_si128(e1, _mm_shuffle_epi32(e1, _MM_SHUFFLE(2, 3, 0, 1)));
+            int mask = _mm_movemask_pd(_mm_castsi128_pd(e0)) | (_mm_movemask_pd(_mm_castsi128_pd(e1)) << 2);
+            if (mask) return i + __builtin_ctz(mask);
+        }
+        return scanScalar(keys, n, key, i);
+    }
+
+    __attribute__((target("avx2")))
+    inline int scanAVX2(const uint64_t* keys, int n, uint64_t key, int from) {
+        int i = from;
+        __m256i k = _mm256_set1_epi64x((long long)key);
+        for (; i + 8 <= n; i += 8) {
+            __m256i e0 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(keys + i)), k);
+            __m256i e1 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(keys + i + 4)), k);
+            int mask = _mm256_movemask_pd(_mm256_castsi256_pd(e0)) | (_mm256_movemask_pd(_mm256_castsi256_pd(e1)) << 4);
+            if (mask) return i + __builtin_ctz(mask);
+        }
+        return scanScalar(keys, n, key, i);
+    }
+#endif
+
+    // --- Runtime Dispatch ---
+
+    inline bool supported(int kernel) {
+        if (kernel == SCALAR) return true;
+#ifdef IDSCAN_X86
+        if (kernel == SSE2) return true; // Baseline on x86-64
+        if (kernel == AVX2) return __builtin_cpu_supports("avx2");
+#endif
+        return false;
+    }
+
+    inline int bestKernel() {
+        if (supported(AVX2)) return AVX2;
+        if (supported(SSE2)) return SSE2;
+        return SCALAR;
+    }
+
+    inline int& activeKernel() {
+        static int active = bestKernel();
+        return active;
+    }
+
+    // Forces a kernel (ignored if this CPU cannot run it)
+    inline bool setKernel(int kernel) {
+        if (!supported(kernel)) return false;
+        activeKernel() = kernel;
+        return true;
+    }
+
+    inline const char* kernelName(int kernel) {
+        if (kernel == AVX2) return "AVX2";
+        if (kernel == SSE2) return "SSE2";
+        return "scalar";
+    }
+
+    inline int find(const uint64_t* keys, int n, uint64_t key, int from = 0) {
+#ifdef IDSCAN_X86
+        switch (activeKernel()) {
+            case AVX2: return scanAVX2(keys, n, key, from);
+            case SSE2: return scanSSE2(keys, n, key, from);
+        }
+#endif
+        return scanScalar(keys, n, key, from);
+    }
+}
+
+#endif
@@ -2,9 +2,20 @@
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <vector>
+#include <unordered_set>
+#include <unordered_map>
+#include <functional>
 
 using namespace std;
 
+// Search orders for LinkedListSystem::setSearchOrder
+enum SearchOrder {
+    SEARCH_FIXED = 0,        // List keeps insertion order (default)
+    SEARCH_MOVE_TO_FRONT = 1, // A hit is relinked to the head
+    SEARCH_TRANSPOSE = 2      // A hit swaps places with its predecessor
+};
+
 // ==========================================
 // CLASS: LinkedListSystem
 // Description: Implements the Flight System using Linked Lists.
@@ -12,19 +23,191 @@ using namespace std;
 // 1. Doubly Linked List for Main Passenger Records (Flexible Deletion).
 // 2. Singly Linked List for Waitlist (Requirement).
 // 3. Merge Sort for efficient sorting of Linked Lists (O(N log N)).
+// 4. Optional self-organizing search (move-to-front / transpose) and a
+//    small hot-ID cache for skewed lookup traffic (off by default).
+// 5. Counting Bloom filter over seated + waitlisted IDs: most unknown IDs
+//    are rejected without walking either list.
+// 6. Optional priority waitlist: cancellations hand the seat to the best
+//    waiter of its class (per-class heaps over the waitlist nodes).
 // ==========================================
-class LinkedListSystem : public FlightSystem {
+class LinkedListSystem final : public FlightSystem {
 private:
     // --- Main List Variables (Doubly Linked List) ---
     Passenger* head;        // Pointer to the first passenger
     Passenger* tail;        // Pointer to the last passenger (for fast insertion)
     int currentCount;       // Total passengers
+    SeatOccupancy occupancy; // Bitmask view of taken seats (free-seat finder)
+    WaitlistTally waitTally; // Waitlist depth per class (stats)
+    ChangeFeed feed;         // Event stream of reservation changes
+    NameIndex nameIndex;     // Name search index (seated + waitlisted)
+    RowBucketIndex buckets;  // Per-row buckets of seated passengers (range queries)
 
     // --- Waitlist Variables (Singly Linked List) ---
     // Stores passengers who are waiting for a seat when the flight is full.
     WaitlistNode* waitlistHead;
     WaitlistNode* waitlistTail;
 
+    // --- Priority Waitlist (off = no auto-fill, as before) ---
+    bool priorityMode;
+    long long waitArrivals;                              // Arrival counter for heap ties
+    WaitlistHeap<WaitlistNode*> waitHeaps[CLASS_COUNT];  // Nodes of each class
+
+    // --- Self-Organizing Search ---
+    // Hits are relinked (never data-swapped), so the row buckets stay valid.
+    static constexpr int HOT_SLOTS = 64;     // Direct-mapped cache, slot = hash(ID) % 64
+    int searchOrder;                         // SearchOrder
+    bool hotCacheOn;
+    Passenger* hotCache[HOT_SLOTS];
+
+    // --- ID Filter (Counting Bloom Filter, seated + waitlisted IDs) ---
+    CountingBloomFilter idBloom;
+    bool idFilterOn;
+
+    void filterAdd(const string& id) {
+        if (!idFilterOn) return;
+        idBloom.add(id);
+        if (idBloom.needsGrow()) rebuildIDFilter(idBloom.plannedIDs() * 2);
+    }
+    void filterRemove(const string& id) {
+        if (idFilterOn) idBloom.remove(id);
+    }
+    // false = ID certainly absent from both lists
+    bool filterMayContain(const string& id) {
+        return !idFilterOn || idBloom.mayContain(id);
+    }
+    void rebuildIDFilter(size_t plannedIDs) {
+        idBloom.reset(plannedIDs);
+        for (Passenger* p = head; p != nullptr; p = p->next) idBloom.add(p->passengerID);
+        for (WaitlistNode* w = waitlistHead; w != nullptr; w = w->next) idBloom.add(w->id);
+    }
+
+    // ==========================================
+    // HELPER: Priority Waitlist
+    // The heap picks the waiter in O(log W); unlinking the node from the
+    // singly linked waitlist still walks to its predecessor.
+    // ==========================================
+    void unlinkWaiter(WaitlistNode* target) {
+        WaitlistNode* prev = nullptr;
+        for (WaitlistNode* w = waitlistHead; w != nullptr; prev = w, w = w->next) {
+            if (w != target) continue;
+            if (prev == nullptr) waitlistHead = w->next;
+            else prev->next = w->next;
+            if (w == waitlistTail) waitlistTail = prev;
+            return;
+        }
+    }
+
+    void forgetWaiter(WaitlistNode* w) {
+        int cls = classCode(w->flightClass);
+        if (cls != CLASS_NONE) waitHeaps[cls].erase(w);
+    }
+
+    void rebuildWaitHeaps() {
+        for (int c = 0; c < CLASS_COUNT; c++) waitHeaps[c].clear();
+        waitArrivals = 0;
+        if (!priorityMode) return;
+        for (WaitlistNode* w = waitlistHead; w != nullptr; w = w->next) {
+            int cls = classCode(w->flightClass);
+            if (cls != CLASS_NONE) waitHeaps[cls].push(w, w->priority, waitArrivals);
+            waitArrivals++;
+        }
+    }
+
+    // Function: Priority mode - the best waiter of the row's class takes the seat.
+    // A waiter leaves the line only once the booking went through (as in
+    // ArraySystem); if it fails, the next best of the class is tried.
+    bool fillFromWaitlist(int row, const string& col) {
+        int cls = FlightGlobal::layout().classOfRow(row);
+        if (!priorityMode || cls == CLASS_NONE) return false;
+        vector<pair<WaitlistNode*, WaitlistHeap<WaitlistNode*>::Key>> stay; // Failed bookings, back into the heap afterwards
+        bool seated = false;
+        while (!seated && !waitHeaps[cls].empty()) {
+            WaitlistNode* w = waitHeaps[cls].top();
+            stay.push_back(make_pair(w, waitHeaps[cls].topKey()));
+            waitHeaps[cls].pop();
+            Log::info() << ">> [Auto-Fill] Seat " << row << col << " freed. Moving " << w->name << " from Waitlist.";
+            if (!addPassenger(w->id, w->name, row, col, w->flightClass)) continue;
+
+            stay.pop_back();
+            unlinkWaiter(w);
+            nameIndex.remove(w->id, true); // Indexed as seated by addPassenger
+            filterRemove(w->id);
+            waitTally.leave(w->flightClass);
+            feed.publish(CHANGE_PROMOTE, w->id, w->name, row, col, w->flightClass);
+            delete w;
+            seated = true;
+        }
+        for (const auto& s : stay) waitHeaps[cls].push(s.first, s.second.priority, s.second.seq);
+        return seated;
+    }
+
+    static int hotSlot(const string& id) { return (int)(hash<string>()(id) & (HOT_SLOTS - 1)); }
+
+    // ==========================================
+    // HELPER: Reorder after a search hit
+    // ==========================================
+    void promoteHit(Passenger* node) {
+        if (node == head) return;
+
+        if (searchOrder == SEARCH_MOVE_TO_FRONT) {
+            // Unlink, then relink as the new head
+            node->prev->next = node->next;
+            if (node->next != nullptr) node->next->prev = node->prev;
+            else tail = node->prev;
+            node->prev = nullptr;
+            node->next = head;
+            head->prev = node;
+            head = node;
+        } else if (searchOrder == SEARCH_TRANSPOSE) {
+            // A <-> P <-> N <-> B  becomes  A <-> N <-> P <-> B
+            Passenger* p = node->prev;
+            Passenger* a = p->prev;
+            Passenger* b = node->next;
+            if (a != nullptr) a->next = node; else head = node;
+            if (b != nullptr) b->prev = p; else tail = p;
+            node->prev = a;
+            node->next = p;
+            p->prev = node;
+            p->next = b;
+        }
+    }
+
+    // ==========================================
+    // HELPER: Unlink & Free a Passenger Node
+    // ==========================================
+    void unlinkPassenger(Passenger* current) {
+        // Drop any cache slot still pointing at this node (sorting swaps data,
+        // so the slot is not necessarily the one of its current ID)
+        for (int i = 0; i < HOT_SLOTS; i++) {
+            if (hotCache[i] == current) hotCache[i] = nullptr;
+        }
+
+        // Case 1: Removing Head Node
+        if (current == head) {
+            head = current->next;
+            if (head != nullptr) head->prev = nullptr;
+            else tail = nullptr; // List became empty
+        }
+        // Case 2: Removing Tail Node
+        else if (current == tail) {
+            tail = current->prev;
+            tail->next = nullptr;
+        }
+        // Case 3: Removing Middle Node
+        else {
+            current->prev->next = current->next;
+            current->next->prev = current->prev;
+        }
+
+        occupancy.release(current->seatRow, FlightGlobal::getColIndex(current->seatCol));
+        buckets.clear(current->seatRow, FlightGlobal::getColIndex(current->seatCol));
+        feed.publish(CHANGE_SEAT_REMOVE, current->passengerID, current->name, current->seatRow, current->seatCol, current->flightClass);
+        nameIndex.remove(current->passengerID, false);
+        filterRemove(current->passengerID);
+        delete current; // Free memory
+        currentCount--;
+    }
+
     // ==========================================
     // HELPER: Merge Sort Implementation
     // ==========================================
@@ -79,6 +262,20 @@ private:
         return merge(node, second);      // Conquer (Merge)
     }
 
+    // --- Hooks for FlightSystem's shared seat features (auto-assign, group booking) ---
+    SeatOccupancy* seatOccupancy() override { return &occupancy; }
+
+    // Function: First group ID that already has a seat (one pass, skipped
+    // when the Bloom filter rules out every ID)
+    string findSeatedID(const unordered_set<string>& ids) override {
+        bool anyKnown = false;
+        for (const string& id : ids) anyKnown = filterMayContain(id) || anyKnown;
+        for (Passenger* p = anyKnown ? head : nullptr; p != nullptr; p = p->next) {
+            if (ids.count(p->passengerID)) return p->passengerID;
+        }
+        return "";
+    }
+
 public:
     // ==========================================
     // CONSTRUCTOR & DESTRUCTOR
@@ -87,10 +284,18 @@ public:
         head = nullptr;
         tail = nullptr;
         currentCount = 0;
+        occupancy.reset(FlightGlobal::layout());
+        buckets.reset(FlightGlobal::layout());
+        searchOrder = SEARCH_FIXED;
+        hotCacheOn = false;
+        for (int i = 0; i < HOT_SLOTS; i++) hotCache[i] = nullptr;
+        idFilterOn = true;
 
         // Initialize Waitlist
         waitlistHead = nullptr;
         waitlistTail = nullptr;
+        priorityMode = false;
+        waitArrivals = 0;
         
         cout << ">> Linked List System Initialized." << endl;
     }
@@ -122,17 +327,42 @@ public:
     
     // --- NEW VALIDATION ---
     if (!validateSeatClass(row, fclass)) {
-        cout << ">> [Error] Class Mismatch! " << fclass << " passengers cannot sit in Row " << row << "." << endl;
+        Log::error() << ">> [Error] Class Mismatch! " << fclass << " passengers cannot sit in Row " << row << ".";
         
-        // Optional: Suggest the correct rows
-        if (fclass == "First") cout << ">> [Hint] First Class is Rows 1-3." << endl;
-        else if (fclass == "Business") cout << ">> [Hint] Business Class is Rows 4-10." << endl;
-        else cout << ">> [Hint] Economy Class is Rows 11+." << endl;
+        // Optional: Suggest the correct rows (zones come from the aircraft layout)
+        int cls = classCode(fclass);
+        if (cls != CLASS_NONE) Log::warn() << ">> [Hint] " << fclass << " Class is " << FlightGlobal::layout().zoneText(cls) << ".";
+        else Log::warn() << ">> [Hint] Class must be First, Business or Economy.";
 
         return false;
         }
+
+        // Seat must exist on this aircraft, blocked seats (exits, galleys...) are never sold
+        int cIndex = FlightGlobal::getColIndex(col);
+        if (cIndex == -1 || row < 1 || row > FlightGlobal::totalRows()) {
+            Log::error() << ">> [Error] Invalid Seat Position.";
+            return false;
+        }
+        if (FlightGlobal::layout().isBlocked(row, cIndex)) {
+            Log::error() << ">> [Error] Seat " << row << col << " is blocked on this aircraft.";
+            return false;
+        }
         
         Passenger* temp = head;
+        bool duplicate = false;
+        bool maybeKnown = !idFilterOn || idBloom.probe(id); // Not in the filter metrics: the waitlist is not walked here
+
+        // 0. ID FILTER: a new ID needs no traversal, the seat is checked in its row bucket
+        if (!maybeKnown) {
+            Passenger* holder = buckets.at(row, cIndex);
+            if (holder != nullptr) {
+                Log::info() << ">> [System] Seat " << row << col << " is taken by " << holder->name
+                     << ". Adding " << name << " to Waitlist...";
+                addToWaitlist(id, name, row, col, fclass);
+                return false;
+            }
+            temp = nullptr; // Skip the traversal
+        }
         
         // 1. TRAVERSAL CHECK (O(N) Time Complexity)
         while (temp != nullptr) {
@@ -141,8 +371,8 @@ public:
                 // OLD CODE: cout << ">> [Failed] Seat " << row << col << " is already occupied..."
                 
                 // NEW CODE: Handle the collision by adding to Waitlist
-                cout << ">> [System] Seat " << row << col << " is taken by " << temp->name 
-                     << ". Adding " << name << " to Waitlist..." << endl;
+                Log::info() << ">> [System] Seat " << row << col << " is taken by " << temp->name 
+                     << ". Adding " << name << " to Waitlist...";
                 
                 // >>> THIS IS THE MISSING LINE <<<
                 addToWaitlist(id, name, row, col, fclass); 
@@ -151,12 +381,15 @@ public:
             }
 
             // --- DUPLICATE ID CHECK ---
-            if (temp->passengerID == id) {
-                cout << ">> [Failed] Passenger ID " << id << " already exists." << endl;
-                return false; 
-            }
+            // Keep scanning: a taken seat wins whatever the list order
+            // (move-to-front / transpose reorder the list between calls)
+            if (temp->passengerID == id) duplicate = true;
             temp = temp->next;
         }
+        if (duplicate) {
+            Log::warn() << ">> [Failed] Passenger ID " << id << " already exists.";
+            return false;
+        }
 
         // 2. Create New Node (If no collision, proceed as normal...)
         Passenger* newP = new Passenger;
@@ -178,6 +411,11 @@ public:
             tail = newP;         
         }
         currentCount++;
+        occupancy.occupy(row, cIndex);
+        buckets.place(newP, row, cIndex);
+        nameIndex.add(id, name, false);
+        filterAdd(id);
+        feed.publish(CHANGE_SEAT_ADD, id, name, row, col, fclass);
         // cout << ">> [Success] ... " << endl; // Optional: Comment out to reduce spam during loading
         return true;
     }
@@ -186,7 +424,7 @@ public:
     // FUNCTION 2: Cancellation (Deletion)
     // ==========================================
     bool removePassenger(string id) override {
-        if (head == nullptr) return false;
+        if (head == nullptr || !filterMayContain(id)) return false;
 
         Passenger* current = head;
 
@@ -194,26 +432,10 @@ public:
         while (current != nullptr) {
             if (current->passengerID == id) {
                 // FOUND! Now unlink it (Pointer rewiring)
-                
-                // Case 1: Removing Head Node
-                if (current == head) {
-                    head = current->next;
-                    if (head != nullptr) head->prev = nullptr;
-                    else tail = nullptr; // List became empty
-                }
-                // Case 2: Removing Tail Node
-                else if (current == tail) {
-                    tail = current->prev;
-                    tail->next = nullptr;
-                }
-                // Case 3: Removing Middle Node
-                else {
-                    current->prev->next = current->next;
-                    current->next->prev = current->prev;
-                }
-
-                delete current; // Free memory
-                currentCount--;
+                int freedRow = current->seatRow;
+                string freedCol = current->seatCol;
+                unlinkPassenger(current);
+                fillFromWaitlist(freedRow, freedCol); // Priority mode only
                 return true;
             }
             current = current->next;
@@ -225,11 +447,23 @@ public:
     // FUNCTION 3: Search (Modified to check Waitlist)
     // ==========================================
     Passenger* searchPassenger(const string& id) override {
+        // 0. ID filter: unknown IDs stop here
+        if (!filterMayContain(id)) return nullptr;
+
+        // Hot-ID cache (entries are re-checked: sorting swaps node data)
+        if (hotCacheOn) {
+            Passenger* cached = hotCache[hotSlot(id)];
+            if (cached != nullptr && cached->passengerID == id) return cached;
+        }
+
         // 1. First, check the Main Flight (Seated Passengers)
         Passenger* current = head;
         while (current != nullptr) {
             if (current->passengerID == id) {
-                return current; // Found on the plane!
+                // Found on the plane!
+                if (hotCacheOn) hotCache[hotSlot(id)] = current;
+                promoteHit(current);
+                return current;
             }
             current = current->next;
         }
@@ -245,17 +479,14 @@ public:
                 static Passenger tempResult; 
                 // Using 'static' ensures this object survives after the function ends so main.cpp can read it.
                 
-                tempResult.passengerID = wTemp->id;
-                tempResult.name = wTemp->name + " [WAITLIST]"; // Add a tag so you know
-                tempResult.seatRow = 0;      // 0 indicates no seat
-                tempResult.seatCol = "WL";   // "WL" for Waitlist
-                tempResult.flightClass = wTemp->flightClass;
+                tempResult = waitlistRecord(wTemp->id, wTemp->name, wTemp->flightClass); // Row 0, column "WL"
                 
                 return &tempResult;
             }
             wTemp = wTemp->next;
         }
 
+        if (idFilterOn) idBloom.noteFalsePositive(); // Filter said "maybe"
         return nullptr; // Really not found anywhere
     }
 
@@ -281,14 +512,7 @@ public:
             cout << "==========================================================================" << endl;
             cout << "                    FLIGHT SEATING MAP (LINKED LIST)                      " << endl;
             cout << "==========================================================================" << endl;
-            cout << "      " 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[A]" 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[B]" 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[C]" 
-                 << "    " 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[D]" 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[E]" 
-                 << left << setw(FlightGlobal::COL_WIDTH) << "[F]" << endl;
+            FlightGlobal::printSeatMapHeader();
             cout << "--------------------------------------------------------------------------" << endl;
 
             int startRow = (currentPage - 1) * FlightGlobal::ROWS_PER_PAGE;
@@ -299,13 +523,11 @@ public:
             for (int r = startRow; r < endRow; r++) {
                 int actualRow = r + 1;
                 
-                string rowClass = "Eco"; 
-                if (r < 3) rowClass = "Fst";      
-                else if (r < 10) rowClass = "Bus";
+                string rowClass = FlightGlobal::layout().rowLabel(actualRow);
 
                 cout << rowClass << setw(2) << setfill('0') << actualRow << setfill(' ') << " ";
 
-                for (int c = 0; c < FlightGlobal::COLS; c++) {
+                for (int c = 0; c < FlightGlobal::cols(); c++) {
                     string colName = FlightGlobal::getColName(c);
                     
                     // SEARCH the list for this specific seat (row, col)
@@ -323,7 +545,7 @@ public:
                     if (foundName.length() > 12) foundName = foundName.substr(0, 9) + "..";
 
                     cout << "[" << left << setw(10) << foundName << "] ";
-                    if (c == 2) cout << "    "; 
+                    if (FlightGlobal::layout().aisleAfter(c) && c < FlightGlobal::cols() - 1) cout << "    "; 
                 }
                 cout << endl;
             }
@@ -413,6 +635,9 @@ public:
                     swap(ptr1->seatRow, ptr1->next->seatRow);
                     swap(ptr1->seatCol, ptr1->next->seatCol);
                     swap(ptr1->flightClass, ptr1->next->flightClass);
+                    // Seats moved to other nodes: point their buckets at the new nodes
+                    buckets.place(ptr1, ptr1->seatRow, FlightGlobal::getColIndex(ptr1->seatCol));
+                    buckets.place(ptr1->next, ptr1->next->seatRow, FlightGlobal::getColIndex(ptr1->next->seatCol));
                     swapped = true;
                 }
                 ptr1 = ptr1->next;
@@ -428,13 +653,47 @@ public:
     // WAITLIST IMPLEMENTATION (Singly Linked List)
     // ==========================================
     void addToWaitlist(string id, string name, int row, string col, string fclass) override {
+        enqueueWaiter(id, name, row, col, fclass, WAIT_FARE_PAID);
+        Log::info() << ">> [Waitlist] " << name << " added for seat " << row << col << ".";
+    }
+
+    void addStandby(string id, string name, int row, string col, string fclass) override {
+        enqueueWaiter(id, name, row, col, fclass, WAIT_STANDBY);
+        Log::info() << ">> [Waitlist] " << name << " added on standby for seat " << row << col << ".";
+    }
+
+    // Function: Leave the waitlist without a seat (O(N) walk of the waitlist)
+    bool cancelWaitlist(const string& id) override {
+        if (!filterMayContain(id)) return false;
+        WaitlistNode* prev = nullptr;
+        for (WaitlistNode* w = waitlistHead; w != nullptr; prev = w, w = w->next) {
+            if (w->id != id) continue;
+            if (prev == nullptr) waitlistHead = w->next;
+            else prev->next = w->next;
+            if (w == waitlistTail) waitlistTail = prev;
+            nameIndex.remove(w->id, true);
+            filterRemove(w->id);
+            if (priorityMode) forgetWaiter(w);
+            waitTally.leave(w->flightClass);
+            feed.publish(CHANGE_WAIT_LEAVE, w->id, w->name, w->row, w->col, w->flightClass);
+            delete w;
+            return true;
+        }
+        return false;
+    }
+    bool supportsCancelWaitlist() const override { return true; }
+
+    void enqueueWaiter(const string& id, const string& name, int row, const string& col, const string& fclass, int priority) {
         WaitlistNode* newNode = new WaitlistNode;
         newNode->id = id;
         newNode->name = name;
         newNode->row = row;
         newNode->col = col;
         newNode->flightClass = fclass;
+        newNode->priority = priority;
         newNode->next = nullptr;
+        waitTally.join(fclass);
+        feed.publish(CHANGE_WAIT_JOIN, id, name, row, col, fclass);
 
         if (waitlistHead == nullptr) {
             waitlistHead = newNode;
@@ -443,7 +702,149 @@ public:
             waitlistTail->next = newNode;
             waitlistTail = newNode;
         }
-        cout << ">> [Waitlist] " << name << " added for seat " << row << col << "." << endl;
+        nameIndex.add(id, name, true);
+        filterAdd(id);
+        int cls = classCode(fclass);
+        if (priorityMode && cls != CLASS_NONE) waitHeaps[cls].push(newNode, priority, waitArrivals);
+        waitArrivals++;
+    }
+
+    // Off (default): cancellations leave the seat empty, as before
+    bool setPriorityWaitlist(bool on) override {
+        priorityMode = on;
+        rebuildWaitHeaps();
+        return true;
+    }
+    bool priorityWaitlist() const override { return priorityMode; }
+
+    // Benchmark / tuning switches for skewed lookup traffic.
+    // Reordering changes the manifest order until the next sort.
+    void setSearchOrder(int order) { searchOrder = order; }
+    void setHotCache(bool on) {
+        hotCacheOn = on;
+        for (int i = 0; i < HOT_SLOTS; i++) hotCache[i] = nullptr;
+    }
+    // Benchmark switch: ID filter on (default) / off
+    void setIDFilter(bool on) {
+        idFilterOn = on;
+        if (on) rebuildIDFilter(currentCount > 1024 ? currentCount * 2 : 1024);
+    }
+
+    const CountingBloomFilter* idFilter() const override { return idFilterOn ? &idBloom : nullptr; }
+
+    bool flightStats(FlightStats& stats) override {
+        fillSeatStats(stats, occupancy);
+        waitTally.fill(stats);
+        return true;
+    }
+
+    const ChangeFeed* changeFeed() const override { return &feed; }
+    void setChangeFeed(bool on) { feed.setEnabled(on); } // Benchmark switch
+
+    // ==========================================
+    // FEATURE: Range Queries (Row Buckets)
+    // ==========================================
+    vector<Passenger*> queryPassengers(int fromRow, int toRow, int cls, int col) override {
+        return buckets.query(fromRow, toRow, cls, col);
+    }
+
+    // ==========================================
+    // FEATURE: Name Search (Prefix / Fuzzy Index)
+    // ==========================================
+    vector<NameMatch> searchByName(const string& query, int k) override {
+        return nameIndex.search(query, k > 0 ? (size_t)k : 0);
+    }
+
+    // ==========================================
+    // FEATURE: Batch Cancellation
+    // One pass over the main list and one over the waitlist, checking each
+    // node against a hash set of the IDs: O(N + W) for the whole batch instead
+    // of O(N) per ID. (No auto-fill unless the priority waitlist is on:
+    // then the freed seats are filled class by class, First first.)
+    // ==========================================
+    int removePassengers(const vector<string>& ids) override {
+        unordered_set<string> targets(ids.begin(), ids.end());
+        vector<pair<int, string>> freedSeats[CLASS_COUNT]; // Priority mode only
+        int left = (int)targets.size();
+        int removed = 0;
+
+        // 1. Main list (stops early once every ID was found)
+        Passenger* current = head;
+        while (current != nullptr && left > 0) {
+            Passenger* nextNode = current->next;
+            if (targets.count(current->passengerID)) {
+                int cls = FlightGlobal::layout().classOfRow(current->seatRow);
+                if (priorityMode && cls != CLASS_NONE) freedSeats[cls].push_back(make_pair(current->seatRow, current->seatCol));
+                unlinkPassenger(current);
+                removed++;
+                left--;
+            }
+            current = nextNode;
+        }
+
+        // 2. Waitlist (Singly Linked: keep the previous node for unlinking)
+        WaitlistNode* wPrev = nullptr;
+        WaitlistNode* wCurr = waitlistHead;
+        while (wCurr != nullptr && left > 0) {
+            WaitlistNode* wNext = wCurr->next;
+            if (targets.count(wCurr->id)) {
+                if (wPrev == nullptr) waitlistHead = wNext;
+                else wPrev->next = wNext;
+                if (wCurr == waitlistTail) waitlistTail = wPrev;
+                nameIndex.remove(wCurr->id, true);
+                filterRemove(wCurr->id);
+                if (priorityMode) forgetWaiter(wCurr);
+                waitTally.leave(wCurr->flightClass);
+                feed.publish(CHANGE_WAIT_LEAVE, wCurr->id, wCurr->name, wCurr->row, wCurr->col, wCurr->flightClass);
+                delete wCurr;
+                removed++;
+                left--;
+            } else {
+                wPrev = wCurr;
+            }
+            wCurr = wNext;
+        }
+
+        // 3. Priority mode: promote into the freed seats
+        int promoted = 0;
+        for (int cls = 0; cls < CLASS_COUNT; cls++) {
+            for (const pair<int, string>& seat : freedSeats[cls]) promoted += fillFromWaitlist(seat.first, seat.second) ? 1 : 0;
+        }
+
+        cout << ">> [Batch] Cancelled " << removed << " of " << ids.size() << " IDs." << endl;
+        if (priorityMode) cout << ">> [Batch] " << promoted << " promoted from Waitlist." << endl;
+        return removed;
+    }
+
+    // ==========================================
+    // FEATURE: Batch Lookup
+    // Same single pass: main list, then waitlist, until every ID is resolved.
+    // ==========================================
+    vector<Passenger*> searchPassengers(const vector<string>& ids) override {
+        vector<Passenger*> result(ids.size(), nullptr);
+        unordered_map<string, vector<int>> pending; // ID -> positions in 'ids'
+        for (int i = 0; i < (int)ids.size(); i++) {
+            if (filterMayContain(ids[i])) pending[ids[i]].push_back(i);
+        }
+
+        for (Passenger* p = head; p != nullptr && !pending.empty(); p = p->next) {
+            auto found = pending.find(p->passengerID);
+            if (found == pending.end()) continue;
+            for (int i : found->second) result[i] = p;
+            pending.erase(found);
+        }
+
+        batchWaitlistHits.clear();
+        batchWaitlistHits.reserve(pending.size()); // No reallocation: result pointers stay valid
+        for (WaitlistNode* w = waitlistHead; w != nullptr && !pending.empty(); w = w->next) {
+            auto found = pending.find(w->id);
+            if (found == pending.end()) continue;
+
+            batchWaitlistHits.push_back(waitlistRecord(w->id, w->name, w->flightClass));
+            for (int i : found->second) result[i] = &batchWaitlistHits.back();
+            pending.erase(found);
+        }
+        return result;
     }
 
     // ==========================================
@@ -0,0 +1,237 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "FlightCommon.hpp"
+#include "Timer.hpp"
+
+using namespace std;
+
+// ==========================================
+// TOOL: Load Generator for the Command Server
+// Description: Drives `main --serve <socket>` with a random mix of ADD /
+// SEARCH / REMOVE commands over one Unix-domain connection.
+// 1. Up to --pipeline commands are in flight: new commands are written
+//    in one batch as soon as answers come back (1 = request / response).
+// 2. Every answer is matched to its command in order, giving throughput
+//    and round-trip latency percentiles.
+// IDs start at --start-id so they do not clash with the loaded CSV;
+// REMOVE and SEARCH pick IDs this client added earlier.
+//
+// Build: g++ -std=c++17 -O2 LoadClient.cpp -o loadclient
+// Usage: loadclient --socket /tmp/flight.sock [--ops 100000] [--pipeline 64]
+//                   [--mix 40,40,20] [--seed 7] [--start-id 5000000] [--shutdown]
+// ==========================================
+
+struct ClientConfig {
+    string socketPath;
+    long long ops = 100000;
+    int pipeline = 64;          // Commands in flight
+    int addPct = 40;            // Command mix (ADD / SEARCH / REMOVE)
+    int searchPct = 40;
+    int removePct = 20;
+    unsigned long long seed = 7;
+    long long startID = 5000000;
+    bool shutdown = false;      // Send SHUTDOWN when done
+};
+
+void printUsage() {
+    cout << "Usage: loadclient --socket <path> [--ops N] [--pipeline N] [--mix add,search,remove]\n"
+         << "                  [--seed N] [--start-id N] [--shutdown]" << endl;
+}
+
+bool parseArgs(int argc, char* argv[], ClientConfig& cfg) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--help" || arg == "-h") { printUsage(); return false; }
+        if (arg == "--shutdown") { cfg.shutdown = true; continue; }
+        if (i + 1 >= argc) {
+            cerr << ">> [Error] Missing value for " << arg << endl;
+            return false;
+        }
+        string val = argv[++i];
+        try {
+            if (arg == "--socket") cfg.socketPath = val;
+            else if (arg == "--ops") cfg.ops = stoll(val);
+            else if (arg == "--pipeline") cfg.pipeline = stoi(val);
+            else if (arg == "--seed") cfg.seed = stoull(val);
+            else if (arg == "--start-id") cfg.startID = stoll(val);
+            else if (arg == "--mix") {
+                if (sscanf(val.c_str(), "%d,%d,%d", &cfg.addPct, &cfg.searchPct, &cfg.removePct) != 3) {
+                    cerr << ">> [Error] --mix expects three comma separated numbers." << endl;
+                    return false;
+                }
+            } else {
+                cerr << ">> [Error] Unknown option " << arg << endl;
+                printUsage();
+                return false;
+            }
+        } catch (...) {
+            cerr << ">> [Error] Invalid value '" << val << "' for " << arg << endl;
+            return false;
+        }
+    }
+    if (cfg.socketPath.empty()) {
+        printUsage();
+        return false;
+    }
+    if (cfg.ops < 1 || cfg.pipeline < 1 || cfg.addPct + cfg.searchPct + cfg.removePct <= 0) {
+        cerr << ">> [Error] --ops, --pipeline and the mix must be positive." << endl;
+        return false;
+    }
+    return true;
+}
+
+int connectTo(const string& path) {
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) return -1;
+    strcpy(addr.sun_path, path.c_str());
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    if (connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool writeAll(int fd, const string& data) {
+    size_t done = 0;
+    while (done < data.size()) {
+        ssize_t n = write(fd, data.data() + done, data.size() - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        done += n;
+    }
+    return true;
+}
+
+// ==========================================
+// HELPER: Command Generator
+// Seats come from the default aircraft layout, each with a class that
+// passes validateSeatClass().
+// ==========================================
+class CommandMix {
+    const ClientConfig& cfg;
+    mt19937_64 rng;
+    long long nextID;
+    vector<long long> added; // IDs this client added (SEARCH / REMOVE targets)
+
+public:
+    CommandMix(const ClientConfig& c) : cfg(c), rng(c.seed), nextID(c.startID) {}
+
+    string next() {
+        int total = cfg.addPct + cfg.searchPct + cfg.removePct;
+        int pick = (int)(rng() % total);
+        if (pick < cfg.addPct || added.empty()) {
+            long long id = nextID++;
+            added.push_back(id);
+            int row = 1 + (int)(rng() % FlightGlobal::totalRows());
+            string col = FlightGlobal::getColName((int)(rng() % FlightGlobal::cols()));
+            int cls = FlightGlobal::layout().classOfRow(row);
+            return "ADD," + to_string(id) + ",Load Client " + to_string(id) + "," + to_string(row) + "," + col + ","
+                   + className(cls == CLASS_NONE ? CLASS_ECONOMY : cls) + "\n";
+        }
+        size_t k = rng() % added.size();
+        if (pick < cfg.addPct + cfg.searchPct) return "SEARCH," + to_string(added[k]) + "\n";
+        long long id = added[k];
+        added[k] = added.back();
+        added.pop_back();
+        return "REMOVE," + to_string(id) + "\n";
+    }
+};
+
+int main(int argc, char* argv[]) {
+    ClientConfig cfg;
+    if (!parseArgs(argc, argv, cfg)) return 1;
+
+    int fd = connectTo(cfg.socketPath);
+    if (fd < 0) {
+        cerr << ">> [Error] Cannot connect to " << cfg.socketPath << " (is `main --serve` running?)" << endl;
+        return 1;
+    }
+
+    typedef chrono::steady_clock Clock;
+    CommandMix mix(cfg);
+    deque<Clock::time_point> inFlight; // Send time of each unanswered command
+    vector<long long> latencyNs;
+    latencyNs.reserve(cfg.ops);
+    map<string, long long> answers;    // "OK", "WAITLIST", "NOTFOUND"...
+    long long sent = 0;
+    long long writes = 0;
+    string batch, pending;
+    char buf[64 * 1024];
+
+    Timer t;
+    t.start();
+    while ((long long)latencyNs.size() < cfg.ops) {
+        // 1. Top up the pipeline with one write
+        batch.clear();
+        Clock::time_point now = Clock::now();
+        while ((int)inFlight.size() < cfg.pipeline && sent < cfg.ops) {
+            batch += mix.next();
+            inFlight.push_back(now);
+            sent++;
+        }
+        if (!batch.empty()) {
+            if (!writeAll(fd, batch)) {
+                cerr << ">> [Error] Server closed the connection." << endl;
+                return 1;
+            }
+            writes++;
+        }
+
+        // 2. Read whatever answers are there (one line per command)
+        ssize_t n = read(fd, buf, sizeof(buf));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            cerr << ">> [Error] Server closed the connection." << endl;
+            return 1;
+        }
+        Clock::time_point got = Clock::now();
+        pending.append(buf, n);
+        size_t start = 0, nl;
+        while ((nl = pending.find('\n', start)) != string::npos) {
+            string line = pending.substr(start, nl - start);
+            start = nl + 1;
+            answers[line.substr(0, line.find(','))]++;
+            latencyNs.push_back(chrono::duration_cast<chrono::nanoseconds>(got - inFlight.front()).count());
+            inFlight.pop_front();
+        }
+        pending.erase(0, start);
+    }
+    t.stop();
+
+    if (cfg.shutdown) {
+        writeAll(fd, "SHUTDOWN\n");
+        read(fd, buf, sizeof(buf)); // BYE
+    } else {
+        writeAll(fd, "QUIT\n");
+    }
+    close(fd);
+
+    sort(latencyNs.begin(), latencyNs.end());
+    long long micros = t.getDurationInMicroseconds();
+    cout << ">> " << cfg.ops << " commands, pipeline " << cfg.pipeline << ", " << writes << " writes" << endl;
+    cout << ">> Throughput : " << (long long)(cfg.ops * 1e6 / (micros > 0 ? micros : 1)) << " commands/s ("
+         << micros / 1000 << " ms)" << endl;
+    cout << ">> Round trip : p50 " << latencyNs[latencyNs.size() / 2] / 1000 << " us, p99 "
+         << latencyNs[latencyNs.size() * 99 / 100] / 1000 << " us, max " << latencyNs.back() / 1000 << " us" << endl;
+    cout << ">> Answers    :";
+    for (const auto& a : answers) cout << " " << a.first << "=" << a.second;
+    cout << endl;
+    return 0;
+}
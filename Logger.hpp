@@ -0,0 +1,225 @@
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+using namespace std;
+
+// ==========================================
+// MODULE: Log (Asynchronous Buffered Logger)
+// Description: Status lines from the systems' hot paths ("[System] Seat
+// ... is taken", "[Waitlist] ... added") without a console flush per line.
+// 1. Levels: DEBUG < INFO < WARN < ERROR < OFF. A line below the active
+//    level costs one atomic load (quiet mode = WARN).
+// 2. A line is formatted into a stack buffer, then copied into a
+//    lock-free ring of fixed-size slots (any thread may log).
+// 3. A background writer thread drains the ring in batches: one fwrite
+//    for many lines, fflush only when the ring runs empty.
+// 4. If the ring is full the line is dropped and counted, so ingest speed
+//    never depends on how fast the terminal scrolls.
+// Synchronous mode (used by the interactive menu) writes each line
+// straight away, so log lines and cout output stay in order.
+// ==========================================
+namespace Log {
+
+    enum Level { DEBUG = 0, INFO = 1, WARN = 2, ERROR = 3, OFF = 4 };
+
+    class AsyncLogger {
+    public:
+        static constexpr int SLOTS = 8192;       // Ring size (power of two)
+        static constexpr int LINE_BYTES = 192;   // Longer lines are cut
+
+    private:
+        struct Slot {
+            atomic<size_t> seq;   // == position: free, == position + 1: holds a line
+            uint16_t len;
+            char text[LINE_BYTES];
+        };
+
+        Slot* ring;
+        atomic<size_t> head{0};      // Next position to claim (producers)
+        size_t tail = 0;             // Next position to write (writer thread only)
+        atomic<size_t> written{0};   // Lines written and flushed so far
+        atomic<int> activeLevel{INFO};
+        atomic<bool> synchronous{false};
+        atomic<bool> running{false};
+        atomic<long long> droppedLines{0};
+        atomic<FILE*> out{stdout};
+        thread writer;
+
+        void writerLoop() {
+            static char batch[64 * 1024];
+            while (true) {
+                size_t used = 0;
+                size_t lines = 0;
+                while (used + LINE_BYTES + 1 <= sizeof(batch)) {
+                    Slot& s = ring[tail & (SLOTS - 1)];
+                    if (s.seq.load(memory_order_acquire) != tail + 1) break; // Empty (or not published yet)
+                    memcpy(batch + used, s.text, s.len);
+                    used += s.len;
+                    s.seq.store(tail + SLOTS, memory_order_release);         // Slot free for the next lap
+                    tail++;
+                    lines++;
+                }
+                if (lines > 0) {
+                    fwrite(batch, 1, used, out.load());
+                    if (ring[tail & (SLOTS - 1)].seq.load(memory_order_acquire) != tail + 1) fflush(out.load());
+                    written.fetch_add(lines, memory_order_release);
+                    continue;
+                }
+                if (!running.load(memory_order_acquire)) return;
+                this_thread::sleep_for(chrono::microseconds(500));
+            }
+        }
+
+        void startWriter() {
+            bool expected = false;
+            if (running.compare_exchange_strong(expected, true)) writer = thread(&AsyncLogger::writerLoop, this);
+        }
+
+    public:
+        AsyncLogger() {
+            ring = new Slot[SLOTS];
+            for (size_t i = 0; i < (size_t)SLOTS; i++) ring[i].seq.store(i, memory_order_relaxed);
+        }
+
+        ~AsyncLogger() {
+            if (running.exchange(false)) writer.join(); // The writer drains the ring before it stops
+            fflush(out.load());
+            delete[] ring;
+        }
+
+        bool enabled(int level) const { return level >= activeLevel.load(memory_order_relaxed); }
+        int level() const { return activeLevel.load(); }
+        void setLevel(int level) { activeLevel.store(level); }
+        long long dropped() const { return droppedLines.load(); }
+
+        // Function: Queue one finished line (ends with '\n')
+        void push(const char* text, size_t len) {
+            if (synchronous.load(memory_order_relaxed)) {
+                fwrite(text, 1, len, out.load());
+                fflush(out.load());
+                return;
+            }
+            if (!running.load(memory_order_relaxed)) startWriter();
+
+            size_t pos = head.load(memory_order_relaxed);
+            Slot* s;
+            while (true) {
+                s = &ring[pos & (SLOTS - 1)];
+                size_t seq = s->seq.load(memory_order_acquire);
+                if (seq == pos) {
+                    if (head.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+                } else if (seq < pos) {
+                    droppedLines.fetch_add(1, memory_order_relaxed); // Ring full
+                    return;
+                } else {
+                    pos = head.load(memory_order_relaxed);
+                }
+            }
+            s->len = (uint16_t)len;
+            memcpy(s->text, text, len);
+            s->seq.store(pos + 1, memory_order_release);
+        }
+
+        // Function: Wait until every queued line is on the output
+        void flush() {
+            size_t target = head.load(memory_order_acquire);
+            if (running.load()) {
+                while (written.load(memory_order_acquire) < target) this_thread::sleep_for(chrono::microseconds(100));
+            }
+            fflush(out.load());
+        }
+
+        // Synchronous = every line written (and flushed) by the caller
+        void setSynchronous(bool on) {
+            if (on) flush();
+            synchronous.store(on);
+        }
+
+        void setOutput(FILE* f) {
+            flush();
+            out.store(f);
+        }
+    };
+
+    inline AsyncLogger& logger() {
+        static AsyncLogger instance;
+        return instance;
+    }
+
+    // ==========================================
+    // CLASS: Line
+    // One log line, built with << like cout and queued when it goes out
+    // of scope. Below the active level every << returns immediately.
+    // ==========================================
+    class Line {
+    private:
+        char text[AsyncLogger::LINE_BYTES];
+        size_t len = 0;
+        bool on;
+
+        void append(const char* s, size_t n) {
+            if (!on) return;
+            size_t room = sizeof(text) - 1 - len; // Keep one byte for '\n'
+            if (n > room) n = room;
+            memcpy(text + len, s, n);
+            len += n;
+        }
+
+    public:
+        explicit Line(int level) : on(logger().enabled(level)) {}
+        Line(const Line&) = delete;
+        ~Line() {
+            if (!on) return;
+            text[len++] = '\n';
+            logger().push(text, len);
+        }
+
+        Line& operator<<(const string& s) { append(s.data(), s.size()); return *this; }
+        Line& operator<<(const char* s) { if (on) append(s, strlen(s)); return *this; }
+        Line& operator<<(char c) { append(&c, 1); return *this; }
+        Line& operator<<(long long v) {
+            if (!on) return *this;
+            char buf[24];
+            int n = snprintf(buf, sizeof(buf), "%lld", v);
+            append(buf, n);
+            return *this;
+        }
+        Line& operator<<(int v) { return *this << (long long)v; }
+        Line& operator<<(size_t v) { return *this << (long long)v; }
+    };
+
+    // Usage: Log::info() << ">> [Waitlist] " << name << " added.";
+    inline Line debug() { return Line(DEBUG); }
+    inline Line info() { return Line(INFO); }
+    inline Line warn() { return Line(WARN); }
+    inline Line error() { return Line(ERROR); }
+
+    inline void setLevel(Level level) { logger().setLevel(level); }
+    inline bool enabled(Level level) { return logger().enabled(level); }
+    inline void flush() { logger().flush(); }
+    inline void setSynchronous(bool on) { logger().setSynchronous(on); }
+    inline void setOutput(FILE* f) { logger().setOutput(f); }
+    inline long long dropped() { return logger().dropped(); }
+
+    // "debug" / "info" / "warn" / "error" / "off"
+    inline bool parseLevel(const string& name, Level& level) {
+        static const char* NAMES[] = { "debug", "info", "warn", "error", "off" };
+        for (int i = 0; i <= OFF; i++) {
+            if (name == NAMES[i]) {
+                level = (Level)i;
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+#endif
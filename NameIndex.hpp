@@ -0,0 +1,350 @@
+#ifndef NAMEINDEX_HPP
+#define NAMEINDEX_HPP
+
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <cctype>
+
+using namespace std;
+
+// One search hit
+struct NameMatch {
+    string id;
+    string name;
+    bool waitlisted;
+    double score;   // 1.0 = prefix match, otherwise trigram similarity (0-1)
+};
+
+// ==========================================
+// CLASS: NameIndex
+// Description: Finds passengers by partial or misspelled name.
+// Names are split into words ("carol", "williams"); each distinct word is
+// stored once in a vocabulary that is far smaller than the passenger list.
+// 1. Prefix search: sorted vocabulary (std::map) -> lower_bound + short walk.
+//    "carol wil" = names containing the word "carol" and a word starting "wil".
+// 2. Fuzzy search: trigram (3-letter) posting lists over the vocabulary find
+//    words close to each query word (Dice similarity); names are then scored
+//    by their best word matches and the top-K returned.
+// Each distinct name keeps the passenger IDs holding it (seated or waitlisted).
+// Maintained by the systems on add / remove / waitlist changes. An ID can be
+// seated and waiting at the same time (or wait twice): holders are keyed by
+// (id, waitlisted) and count their entries, so every add needs one remove.
+// ==========================================
+class NameIndex {
+private:
+    struct Holder {
+        string id;
+        bool waitlisted;
+        int count;               // Entries of this (id, waitlisted) pair
+    };
+
+    struct NameEntry {
+        string display;          // Name as entered (first holder's spelling)
+        string key;              // Normalised: lower case, single spaces
+        vector<int> wordIDs;     // Words of the name (vocabulary ids)
+        vector<Holder> holders;  // Empty = name no longer in use (kept for reuse)
+    };
+
+    struct WordEntry {
+        string text;
+        int gramCount;           // Distinct trigrams of the word
+        vector<int> names;       // Name entries containing this word
+    };
+
+    vector<NameEntry> entries;
+    unordered_map<string, int> entryByKey;              // key -> name entry
+    unordered_map<string, pair<int, int>> slotByID[2];  // [waitlisted] id -> (name entry, holder index)
+
+    vector<WordEntry> vocab;
+    unordered_map<string, int> wordByText;
+    map<string, int> sortedWords;                       // For prefix walks
+    unordered_map<uint32_t, vector<int>> grams;         // trigram -> words containing it
+
+    // Scratch space reused between queries (no allocation per query)
+    vector<uint16_t> wordHits;
+    vector<int> touchedWords;
+    vector<unsigned> nameStamp;
+    unsigned stamp = 0;
+    vector<float> wordScore[2];   // Scores of the close words of the first two query words
+
+    static constexpr size_t FUZZY_WORDS = 16;  // Close words kept per query word
+    static constexpr double MIN_WORD_SCORE = 0.3;
+
+    static string normalise(const string& s) {
+        string out;
+        out.reserve(s.size());
+        for (char ch : s) {
+            unsigned char c = (unsigned char)ch;
+            if (isalnum(c)) out += (char)tolower(c);
+            else if (!out.empty() && out.back() != ' ') out += ' ';
+        }
+        if (!out.empty() && out.back() == ' ') out.pop_back();
+        return out;
+    }
+
+    static vector<string> splitWords(const string& key) {
+        vector<string> out;
+        size_t start = 0;
+        while (start < key.size()) {
+            size_t space = key.find(' ', start);
+            if (space == string::npos) space = key.size();
+            out.push_back(key.substr(start, space - start));
+            start = space + 1;
+        }
+        return out;
+    }
+
+    // Distinct trigrams of " word " (padding makes word starts/ends count)
+    static void trigramsOf(const string& word, vector<uint32_t>& out) {
+        out.clear();
+        string padded = " " + word + " ";
+        for (size_t i = 0; i + 3 <= padded.size(); i++) {
+            uint32_t g = ((uint32_t)(unsigned char)padded[i] << 16) |
+                         ((uint32_t)(unsigned char)padded[i + 1] << 8) |
+                         (uint32_t)(unsigned char)padded[i + 2];
+            out.push_back(g);
+        }
+        sort(out.begin(), out.end());
+        out.erase(unique(out.begin(), out.end()), out.end());
+    }
+
+    int wordFor(const string& text) {
+        auto it = wordByText.find(text);
+        if (it != wordByText.end()) return it->second;
+
+        int w = (int)vocab.size();
+        vector<uint32_t> g;
+        trigramsOf(text, g);
+        vocab.push_back({ text, (int)g.size(), {} });
+        wordByText[text] = w;
+        sortedWords[text] = w;
+        wordHits.push_back(0);
+        wordScore[0].push_back(0);
+        wordScore[1].push_back(0);
+        for (uint32_t gram : g) grams[gram].push_back(w);
+        return w;
+    }
+
+    int entryFor(const string& name, const string& key) {
+        auto it = entryByKey.find(key);
+        if (it != entryByKey.end()) return it->second;
+
+        int e = (int)entries.size();
+        entries.push_back({ name, key, {}, {} });
+        entryByKey[key] = e;
+        nameStamp.push_back(0);
+        for (const string& text : splitWords(key)) {
+            int w = wordFor(text);
+            if (find(entries[e].wordIDs.begin(), entries[e].wordIDs.end(), w) != entries[e].wordIDs.end()) continue;
+            entries[e].wordIDs.push_back(w);
+            vocab[w].names.push_back(e);
+        }
+        return e;
+    }
+
+    // New stamp value: marks "name already visited" without clearing an array
+    unsigned nextStamp() {
+        if (++stamp == 0) {
+            fill(nameStamp.begin(), nameStamp.end(), 0);
+            stamp = 1;
+        }
+        return stamp;
+    }
+
+    void collect(int e, double score, size_t k, vector<NameMatch>& out) const {
+        for (const Holder& h : entries[e].holders) {
+            if (out.size() >= k) return;
+            out.push_back({ h.id, entries[e].display, h.waitlisted, score });
+        }
+    }
+
+    // Vocabulary words similar to 'text', best first (word id, Dice score)
+    vector<pair<int, double>> closeWords(const string& text) {
+        vector<pair<int, double>> out;
+        vector<uint32_t> qGrams;
+        trigramsOf(text, qGrams);
+        for (uint32_t g : qGrams) {
+            auto it = grams.find(g);
+            if (it == grams.end()) continue;
+            for (int w : it->second) {
+                if (wordHits[w]++ == 0) touchedWords.push_back(w);
+            }
+        }
+        for (int w : touchedWords) {
+            double score = 2.0 * wordHits[w] / (double)(qGrams.size() + vocab[w].gramCount);
+            if (score >= MIN_WORD_SCORE) out.push_back(make_pair(w, score));
+            wordHits[w] = 0;
+        }
+        touchedWords.clear();
+
+        size_t top = min(out.size(), FUZZY_WORDS);
+        partial_sort(out.begin(), out.begin() + top, out.end(),
+                     [](const pair<int, double>& a, const pair<int, double>& b) { return a.second > b.second; });
+        out.resize(top);
+        return out;
+    }
+
+public:
+    // Function: Add a seated or waitlisted passenger
+    // Adding the same (id, waitlisted) pair again only counts it (the first name stays).
+    void add(const string& id, const string& name, bool waitlisted) {
+        auto it = slotByID[waitlisted].find(id);
+        if (it != slotByID[waitlisted].end()) {
+            entries[it->second.first].holders[it->second.second].count++;
+            return;
+        }
+        string key = normalise(name);
+        if (key.empty()) return;
+        int e = entryFor(name, key);
+        entries[e].holders.push_back({ id, waitlisted, 1 });
+        slotByID[waitlisted][id] = make_pair(e, (int)entries[e].holders.size() - 1);
+    }
+
+    // Function: Remove one entry of a passenger (O(1): swap with the last holder)
+    void remove(const string& id, bool waitlisted) {
+        auto it = slotByID[waitlisted].find(id);
+        if (it == slotByID[waitlisted].end()) return;
+        int e = it->second.first;
+        int slot = it->second.second;
+        vector<Holder>& holders = entries[e].holders;
+        if (--holders[slot].count > 0) return;
+        if (slot != (int)holders.size() - 1) {
+            holders[slot] = holders.back();
+            slotByID[holders[slot].waitlisted][holders[slot].id].second = slot;
+        }
+        holders.pop_back();
+        slotByID[waitlisted].erase(it);
+    }
+
+    size_t size() const { return slotByID[0].size() + slotByID[1].size(); }
+    size_t distinctNames() const { return entries.size(); }
+    size_t distinctWords() const { return vocab.size(); }
+
+    // Function: Prefix Search
+    // Last query word is a prefix, earlier words must match whole words.
+    vector<NameMatch> searchPrefix(const string& query, size_t k) {
+        vector<NameMatch> out;
+        string q = normalise(query);
+        if (q.empty() || k == 0) return out;
+        vector<string> qWords = splitWords(q);
+        string last = qWords.back();
+        qWords.pop_back();
+
+        // Whole words: every one must exist
+        vector<int> required;
+        for (const string& text : qWords) {
+            auto it = wordByText.find(text);
+            if (it == wordByText.end()) return out;
+            required.push_back(it->second);
+        }
+
+        // "carol wil": walk the names of the rarest whole word, check the rest
+        if (!required.empty()) {
+            int pivot = required[0];
+            for (int w : required) if (vocab[w].names.size() < vocab[pivot].names.size()) pivot = w;
+            for (int e : vocab[pivot].names) {
+                if (out.size() >= k) break;
+                if (entries[e].holders.empty()) continue;
+                const vector<int>& ws = entries[e].wordIDs;
+                bool ok = true;
+                for (int w : required) {
+                    if (find(ws.begin(), ws.end(), w) == ws.end()) { ok = false; break; }
+                }
+                bool prefixHit = false;
+                for (int w : ws) {
+                    if (vocab[w].text.compare(0, last.size(), last) == 0 && find(required.begin(), required.end(), w) == required.end()) prefixHit = true;
+                }
+                if (ok && prefixHit) collect(e, 1.0, k, out);
+            }
+            return out;
+        }
+
+        // Single word: walk the vocabulary words starting with it
+        unsigned mark = nextStamp();
+        for (auto it = sortedWords.lower_bound(last); it != sortedWords.end() && out.size() < k; ++it) {
+            if (it->first.compare(0, last.size(), last) != 0) break;
+            for (int e : vocab[it->second].names) {
+                if (out.size() >= k) break;
+                if (nameStamp[e] == mark || entries[e].holders.empty()) continue;
+                nameStamp[e] = mark;
+                collect(e, 1.0, k, out);
+            }
+        }
+        return out;
+    }
+
+    // Function: Fuzzy Search (best K by word-level trigram similarity)
+    vector<NameMatch> searchFuzzy(const string& query, size_t k) {
+        vector<NameMatch> out;
+        string q = normalise(query);
+        if (q.empty() || k == 0) return out;
+        vector<string> qWords = splitWords(q);
+
+        // 1. Close vocabulary words for every query word
+        vector<vector<pair<int, double>>> close;
+        size_t pivot = 0;
+        size_t pivotCost = (size_t)-1;
+        for (size_t i = 0; i < qWords.size(); i++) {
+            close.push_back(closeWords(qWords[i]));
+            size_t cost = 0;
+            for (const pair<int, double>& c : close[i]) cost += vocab[c.first].names.size();
+            if (!close[i].empty() && cost < pivotCost) { pivot = i; pivotCost = cost; }
+        }
+        if (close[pivot].empty()) return out;
+
+        // 2. Candidates = names holding a word close to the cheapest query word;
+        //    score = mean over query words of the best matching word in the name.
+        //    Close-word scores go into flat per-word arrays (O(1) lookup while scoring).
+        size_t scored = min(qWords.size(), (size_t)2);
+        for (size_t i = 0; i < scored; i++)
+            for (const pair<int, double>& c : close[i]) wordScore[i][c.first] = (float)c.second;
+
+        vector<pair<double, int>> ranked;
+        unsigned mark = nextStamp();
+        for (const pair<int, double>& c : close[pivot]) {
+            for (int e : vocab[c.first].names) {
+                if (nameStamp[e] == mark || entries[e].holders.empty()) continue;
+                nameStamp[e] = mark;
+                double total = 0;
+                for (size_t i = 0; i < qWords.size(); i++) {
+                    double best = 0;
+                    for (int w : entries[e].wordIDs) {
+                        double sc = 0;
+                        if (i < scored) sc = wordScore[i][w];
+                        else for (const pair<int, double>& cw : close[i]) if (cw.first == w) sc = cw.second;
+                        if (sc > best) best = sc;
+                    }
+                    total += best;
+                }
+                ranked.push_back(make_pair(total / qWords.size(), e));
+            }
+        }
+        for (size_t i = 0; i < scored; i++)
+            for (const pair<int, double>& c : close[i]) wordScore[i][c.first] = 0;
+
+        size_t top = min(ranked.size(), k);
+        partial_sort(ranked.begin(), ranked.begin() + top, ranked.end(),
+                     [](const pair<double, int>& a, const pair<double, int>& b) { return a.first > b.first; });
+        for (size_t i = 0; i < top && out.size() < k; i++) collect(ranked[i].second, ranked[i].first, k, out);
+        return out;
+    }
+
+    // Function: Combined Search (prefix hits first, fuzzy hits fill up to K)
+    vector<NameMatch> search(const string& query, size_t k) {
+        vector<NameMatch> out = searchPrefix(query, k);
+        if (out.size() >= k) return out;
+        for (const NameMatch& m : searchFuzzy(query, k)) {
+            bool seen = false;
+            for (const NameMatch& o : out) if (o.id == m.id) { seen = true; break; }
+            if (!seen) out.push_back(m);
+            if (out.size() >= k) break;
+        }
+        return out;
+    }
+};
+
+#endif
@@ -0,0 +1,599 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <unordered_set>
+#include <thread>
+
+#include "FlightCommon.hpp"
+#include "Timer.hpp"
+#include "StaticFlight.hpp"
+#include "DataLoader.hpp"
+#include "WorkStealingPool.hpp"
+
+// Include System Implementations
+#include "ArraySystem.cpp"
+#include "LinkedListSystem.cpp"
+
+using namespace std;
+
+// ==========================================
+// TOOL: Overbooking Simulator (Monte Carlo)
+// Description: How many tickets to sell beyond the seats, given the
+// cancellation and no-show rates. The loaded flight is cloned once per run
+// and a random booking period is replayed through the real system code:
+// 1. Clone: the seated passengers of the CSV, plus the first K waitlisted
+//    ones as the overbooked tickets (K = overbooking level).
+// 2. Booking period: every ticket holder cancels with --cancel probability
+//    (removePassenger, whose auto-fill hands the seat to the waitlist, or
+//    cancelWaitlist), mixed in random order with --demand new requests.
+//    A request is sold only while tickets < seats + K (auto-assigned seat
+//    if its class has one free, else the waitlist).
+// 3. Departure: every ticket holder is a no-show with --no-show
+//    probability. Waitlisted no-shows leave the line first, then seated
+//    no-shows are removed, so auto-fill promotes only passengers who came.
+//    Passengers still waiting then get any free seat of their class.
+// Outcome per run: denied boardings (showed up, no seat) and empty seats.
+// Runs are spread over a WorkStealingPool; each worker reuses one system
+// and a clone only undoes the previous run's changes (no CSV parse, no
+// rebuild of the seated passengers).
+// Waitlists run in priority mode (freed seats go to the same class).
+//
+// Build: g++ -std=c++17 -O2 -pthread OverbookSim.cpp -o overbook
+// Usage: overbook [--csv FILE] [--system array|list] [--runs N] [--overbook 0,5,10]
+//                 [--cancel X] [--no-show X] [--demand N] [--cost denied,empty]
+//                 [--threads N] [--seed N] [--layout FILE|PRESET]
+// ==========================================
+
+struct SimConfig {
+    string csvFile = "flight_passenger_data.csv.csv";
+    string systemName = "array";
+    string layoutFile;            // Empty: aircraft_layout.cfg if present
+    int runs = 2000;              // Runs per overbooking level
+    vector<int> overbook;         // Empty: 0 .. 15% of the seats
+    double cancelRate = 0.05;     // Per ticket, during the booking period
+    double noShowRate = 0.10;     // Per ticket, at departure
+    int demand = -1;              // New requests per run (-1: seats * cancel rate)
+    double deniedCost = 4.0;      // Cost of one denied boarding ...
+    double emptyCost = 1.0;       // ... and of one empty seat
+    int threads = 0;              // 0 = hardware threads
+    unsigned long long seed = 42;
+};
+
+void printUsage() {
+    cout << "Usage: overbook [options]\n"
+         << "  --csv FILE             Flight to clone (default flight_passenger_data.csv.csv)\n"
+         << "  --system NAME          array or list (default array)\n"
+         << "  --runs N               Runs per overbooking level (default 2000)\n"
+         << "  --overbook K1,K2,...   Tickets sold beyond the seats (default 0 .. 15% of seats)\n"
+         << "  --cancel X             Cancellation probability per ticket (default 0.05)\n"
+         << "  --no-show X            No-show probability per ticket (default 0.10)\n"
+         << "  --demand N             New booking requests per run (default seats * cancel)\n"
+         << "  --cost D,E             Cost of a denied boarding, of an empty seat (default 4,1)\n"
+         << "  --threads N            Worker threads (default: hardware threads)\n"
+         << "  --seed N               RNG seed (default 42)\n"
+         << "  --layout FILE|PRESET   Aircraft layout (default aircraft_layout.cfg if present)\n";
+}
+
+bool parseArgs(int argc, char* argv[], SimConfig& cfg) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--help" || arg == "-h") { printUsage(); return false; }
+        if (i + 1 >= argc) {
+            cerr << ">> [Error] Missing value for " << arg << endl;
+            return false;
+        }
+        string val = argv[++i];
+        try {
+            if (arg == "--csv") cfg.csvFile = val;
+            else if (arg == "--system") cfg.systemName = val;
+            else if (arg == "--layout") cfg.layoutFile = val;
+            else if (arg == "--runs") cfg.runs = stoi(val);
+            else if (arg == "--cancel") cfg.cancelRate = stod(val);
+            else if (arg == "--no-show") cfg.noShowRate = stod(val);
+            else if (arg == "--demand") cfg.demand = stoi(val);
+            else if (arg == "--threads") cfg.threads = stoi(val);
+            else if (arg == "--seed") cfg.seed = stoull(val);
+            else if (arg == "--overbook") {
+                stringstream ss(val);
+                string level;
+                while (getline(ss, level, ',')) cfg.overbook.push_back(stoi(level));
+            } else if (arg == "--cost") {
+                if (sscanf(val.c_str(), "%lf,%lf", &cfg.deniedCost, &cfg.emptyCost) != 2) {
+                    cerr << ">> [Error] --cost expects two comma separated numbers." << endl;
+                    return false;
+                }
+            } else {
+                cerr << ">> [Error] Unknown option " << arg << endl;
+                printUsage();
+                return false;
+            }
+        } catch (...) {
+            cerr << ">> [Error] Invalid value '" << val << "' for " << arg << endl;
+            return false;
+        }
+    }
+
+    AircraftLayout layout;
+    if (!cfg.layoutFile.empty()) {
+        if (!layoutPreset(cfg.layoutFile, layout) && !loadLayoutFile(cfg.layoutFile, layout)) {
+            cerr << ">> [Error] Could not load layout " << cfg.layoutFile << endl;
+            return false;
+        }
+        FlightGlobal::setLayout(layout);
+    } else if (loadLayoutFile("aircraft_layout.cfg", layout)) {
+        FlightGlobal::setLayout(layout);
+    }
+
+    if (cfg.systemName != "array" && cfg.systemName != "list") {
+        cerr << ">> [Error] --system must be array or list." << endl;
+        return false;
+    }
+    if (cfg.runs < 1 || cfg.cancelRate < 0 || cfg.cancelRate > 1 || cfg.noShowRate < 0 || cfg.noShowRate > 1) {
+        cerr << ">> [Error] --runs must be positive, --cancel and --no-show between 0 and 1." << endl;
+        return false;
+    }
+    for (int k : cfg.overbook) {
+        if (k < 0) {
+            cerr << ">> [Error] Overbooking levels cannot be negative." << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// ==========================================
+// HELPER: Silence System Output
+// The systems print while they are built and on some batch paths; all of
+// it is dropped while the simulation runs (the logger is off as well).
+// ==========================================
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+class QuietScope {
+    NullBuffer sink;
+    streambuf* saved;
+public:
+    QuietScope() { saved = cout.rdbuf(&sink); }
+    ~QuietScope() { cout.rdbuf(saved); }
+};
+
+// ==========================================
+// STRUCT: FlightImage
+// The loaded flight as flat records: what a clone is rebuilt from.
+// ==========================================
+struct SimTicket {
+    string id;
+    string name;
+    int row;
+    string col;
+    string fclass;
+};
+
+struct FlightImage {
+    vector<SimTicket> seated;
+    vector<SimTicket> waiting;       // Waitlist order
+    int seats[CLASS_COUNT] = { 0, 0, 0 };
+    int capacity = 0;
+    long long nextID = 1;            // First ID free for simulated bookings
+};
+
+// Function: Load the CSV into a system once and keep its seated passengers
+// and its waitlist (CSV order = waitlist order). False if nothing loaded.
+bool captureImage(const string& csvFile, FlightImage& img) {
+    QuietScope quiet;
+    ArraySystem loaded;
+    if (loadData(&loaded, csvFile) == 0) return false;
+
+    for (Passenger* p : loaded.queryPassengers(1, FlightGlobal::totalRows(), CLASS_NONE, -1)) {
+        img.seated.push_back(SimTicket{ p->passengerID, p->name, p->seatRow, p->seatCol, p->flightClass });
+    }
+    FlightStats st;
+    loaded.flightStats(st);
+    for (int c = 0; c < CLASS_COUNT; c++) {
+        img.seats[c] = st.seated[c] + st.freeSeats[c];
+        img.capacity += img.seats[c];
+    }
+
+    ifstream file(csvFile);
+    string line;
+    getline(file, line); // Skip Header
+    unordered_set<string> seen;
+    while (getline(file, line)) {
+        stringstream ss(line);
+        SimTicket t;
+        string rowStr;
+        getline(ss, t.id, ',');
+        getline(ss, t.name, ',');
+        getline(ss, rowStr, ',');
+        getline(ss, t.col, ',');
+        getline(ss, t.fclass, ',');
+        if (!t.fclass.empty() && t.fclass.back() == '\r') t.fclass.pop_back();
+        try { t.row = stoi(rowStr); } catch (...) { continue; }
+        Passenger* p = loaded.searchPassenger(t.id);
+        if (p != nullptr && p->seatRow == 0 && seen.insert(t.id).second) img.waiting.push_back(t);
+    }
+    img.nextID = globalMaxID + 1;
+    return true;
+}
+
+struct RunResult {
+    int denied;      // Showed up, no seat
+    int empty;       // Seats without a passenger at departure
+    int cancelled;
+    int sold;        // New tickets sold during the booking period
+};
+
+// ==========================================
+// CLASS: OverbookRunner
+// One worker's system, reused for every run the worker takes. Between
+// runs it holds the image's seated passengers and an empty waitlist; a
+// run adds the overbooked waitlist, replays its random sequence, measures
+// the outcome and then undoes only what changed:
+// 1. Tickets from the waitlist or sold in the run leave (waitlist first,
+//    so the removals promote nobody).
+// 2. Image passengers who cancelled or did not show are seated again.
+// Seated passengers never move, so the clone costs O(changes), not
+// O(passengers).
+// ==========================================
+template <typename System>
+class OverbookRunner {
+private:
+    struct SimEvent {
+        double at;
+        int ticket; // -1 = new booking request
+        bool operator<(const SimEvent& o) const { return at < o.at; }
+    };
+
+    const FlightImage& img;
+    unique_ptr<System> sys;
+    vector<string> ticketIDs;  // [0, img.seated.size()) = image passengers
+    vector<int> ticketClass;
+    vector<char> alive;
+    vector<int> departed;      // Image passengers out of their seat
+    vector<SimEvent> events;
+    vector<int> noShows;
+    long long cloneNs = 0;
+    long long replayNs = 0;
+
+    // Fresh system holding the image's seated passengers
+    void build() {
+        sys.reset(new System());
+        sys->setChangeFeed(false);
+        sys->setPriorityWaitlist(true);
+        StaticFlight<System> flight(*sys);
+        for (const SimTicket& t : img.seated) flight.addPassenger(t.id, t.name, t.row, t.col, t.fclass);
+    }
+
+    int pickClass(mt19937_64& rng) const {
+        int pick = (int)(rng() % (img.capacity > 0 ? img.capacity : 1));
+        for (int c = 0; c < CLASS_COUNT; c++) {
+            if (pick < img.seats[c]) return c;
+            pick -= img.seats[c];
+        }
+        return CLASS_ECONOMY;
+    }
+
+    // A ticket for a seat somewhere in the class zone (waitlist request)
+    SimTicket newTicket(int cls, mt19937_64& rng) const {
+        const AircraftLayout& layout = FlightGlobal::layout();
+        int span = layout.classEnd[cls] - layout.classStart[cls] + 1;
+        SimTicket t;
+        t.id = to_string(img.nextID + (long long)ticketIDs.size());
+        t.name = "Sim Passenger " + t.id;
+        t.row = layout.classStart[cls] + (int)(rng() % (span > 0 ? span : 1));
+        t.col = FlightGlobal::getColName((int)(rng() % FlightGlobal::cols()));
+        t.fclass = className(cls);
+        return t;
+    }
+
+    void restore(int overbook, mt19937_64& rng) {
+        StaticFlight<System> flight(*sys);
+        ticketIDs.resize(img.seated.size());
+        ticketClass.resize(img.seated.size());
+        for (size_t i = 0; i < img.seated.size(); i++) {
+            ticketIDs[i] = img.seated[i].id;
+            ticketClass[i] = classCode(img.seated[i].fclass);
+        }
+        for (int i = 0; i < overbook; i++) {
+            SimTicket t = i < (int)img.waiting.size() ? img.waiting[i] : newTicket(pickClass(rng), rng);
+            flight.addToWaitlist(t.id, t.name, t.row, t.col, t.fclass);
+            ticketIDs.push_back(t.id);
+            ticketClass.push_back(classCode(t.fclass));
+        }
+        alive.assign(ticketIDs.size(), 1);
+        departed.clear();
+    }
+
+    void undo() {
+        StaticFlight<System> flight(*sys);
+        size_t base = img.seated.size();
+        for (size_t t = base; t < ticketIDs.size(); t++) sys->cancelWaitlist(ticketIDs[t]);
+        for (size_t t = base; t < ticketIDs.size(); t++) flight.removePassenger(ticketIDs[t]);
+        for (int t : departed) {
+            const SimTicket& p = img.seated[t];
+            flight.addPassenger(p.id, p.name, p.row, p.col, p.fclass);
+        }
+
+        FlightStats st;
+        sys->flightStats(st);
+        int seated = 0;
+        for (int c = 0; c < CLASS_COUNT; c++) seated += st.seated[c];
+        if (seated != (int)base || st.waitingTotal != 0) resetToImage(); // Not expected: start over from the image
+    }
+
+    // Full reset through the system calls instead of a new System (whose
+    // constructor prints): every ticket of the run leaves, then the image
+    // is seated again. Runs on the worker thread, so it must not use cout.
+    void resetToImage() {
+        StaticFlight<System> flight(*sys);
+        for (const string& id : ticketIDs) {
+            while (sys->cancelWaitlist(id)) {}
+        }
+        for (const string& id : ticketIDs) flight.removePassenger(id);
+        for (const SimTicket& p : img.seated) flight.addPassenger(p.id, p.name, p.row, p.col, p.fclass);
+    }
+
+public:
+    explicit OverbookRunner(const FlightImage& image) : img(image) { build(); }
+
+    long long cloneNanos() const { return cloneNs; }
+    long long replayNanos() const { return replayNs; }
+
+    RunResult run(const SimConfig& cfg, int overbook, int demand, uint64_t seed) {
+        typedef chrono::steady_clock Clock;
+        mt19937_64 rng(seed);
+        uniform_real_distribution<double> chance(0.0, 1.0);
+        StaticFlight<System> flight(*sys);
+        RunResult r = { 0, 0, 0, 0 };
+        int base = (int)img.seated.size();
+
+        Clock::time_point t0 = Clock::now();
+        restore(overbook, rng);
+        Clock::time_point t1 = Clock::now();
+
+        // 1. Booking period: cancellations and new requests in random order
+        int initial = (int)ticketIDs.size();
+        int tickets = initial;
+        events.clear();
+        for (int t = 0; t < initial; t++) {
+            if (chance(rng) < cfg.cancelRate) events.push_back(SimEvent{ chance(rng), t });
+        }
+        for (int d = 0; d < demand; d++) events.push_back(SimEvent{ chance(rng), -1 });
+        sort(events.begin(), events.end());
+
+        for (const SimEvent& e : events) {
+            if (e.ticket >= 0) {
+                const string& id = ticketIDs[e.ticket];
+                if (!flight.removePassenger(id)) sys->cancelWaitlist(id); // Seated: auto-fill runs
+                else if (e.ticket < base) departed.push_back(e.ticket);
+                alive[e.ticket] = 0;
+                tickets--;
+                r.cancelled++;
+                continue;
+            }
+            if (tickets >= img.capacity + overbook) continue; // Sales limit reached
+            int cls = pickClass(rng);
+            SimTicket t = newTicket(cls, rng);
+            if (sys->countFreeSeats(cls) > 0) sys->autoAssignPassenger(t.id, t.name, t.fclass, SEAT_ANY);
+            else flight.addToWaitlist(t.id, t.name, t.row, t.col, t.fclass);
+            ticketIDs.push_back(t.id);
+            ticketClass.push_back(cls);
+            alive.push_back(1);
+            tickets++;
+            r.sold++;
+        }
+
+        // 2. Departure: no-shows leave (waitlisted ones first)
+        noShows.clear();
+        int shows = 0;
+        for (size_t t = 0; t < ticketIDs.size(); t++) {
+            if (!alive[t]) continue;
+            if (chance(rng) < cfg.noShowRate) noShows.push_back((int)t);
+            else shows++;
+        }
+        for (int& t : noShows) {
+            if (sys->cancelWaitlist(ticketIDs[t])) t = -1;
+        }
+        for (int t : noShows) {
+            if (t < 0) continue;
+            flight.removePassenger(ticketIDs[t]); // Auto-fill: a waiting passenger boards
+            if (t < base) departed.push_back(t);
+        }
+
+        // 3. Gate: waiting passengers who came take any free seat of their class
+        //    (they asked for a particular seat, which may still be taken)
+        for (size_t t = base; t < ticketIDs.size(); t++) {
+            int cls = ticketClass[t];
+            if (!alive[t] || cls == CLASS_NONE || sys->countFreeSeats(cls) == 0) continue;
+            if (sys->cancelWaitlist(ticketIDs[t])) {
+                sys->autoAssignPassenger(ticketIDs[t], "Sim Passenger " + ticketIDs[t], className(cls), SEAT_ANY);
+            }
+        }
+
+        FlightStats st;
+        sys->flightStats(st);
+        int boarded = 0;
+        for (int c = 0; c < CLASS_COUNT; c++) {
+            boarded += st.seated[c];
+            r.empty += st.freeSeats[c];
+        }
+        r.denied = shows > boarded ? shows - boarded : 0;
+        Clock::time_point t2 = Clock::now();
+
+        undo();
+        Clock::time_point t3 = Clock::now();
+        cloneNs += chrono::duration_cast<chrono::nanoseconds>((t1 - t0) + (t3 - t2)).count();
+        replayNs += chrono::duration_cast<chrono::nanoseconds>(t2 - t1).count();
+        return r;
+    }
+};
+
+// ==========================================
+// HELPER: Report
+// ==========================================
+struct Distribution {
+    double mean = 0;
+    int p50 = 0, p90 = 0, p99 = 0, max = 0;
+    double positive = 0; // Share of runs with a value > 0
+};
+
+Distribution summarize(vector<int> values) {
+    Distribution d;
+    if (values.empty()) return d;
+    sort(values.begin(), values.end());
+    long long sum = 0;
+    int positive = 0;
+    for (int v : values) {
+        sum += v;
+        if (v > 0) positive++;
+    }
+    size_t n = values.size();
+    d.mean = (double)sum / n;
+    d.p50 = values[n / 2];
+    d.p90 = values[n * 90 / 100];
+    d.p99 = values[n * 99 / 100];
+    d.max = values.back();
+    d.positive = 100.0 * positive / n;
+    return d;
+}
+
+void printHistogram(const vector<int>& values, const string& label) {
+    int maxValue = 0;
+    for (int v : values) maxValue = max(maxValue, v);
+    vector<int> counts(maxValue + 1, 0);
+    for (int v : values) counts[v]++;
+    int peak = *max_element(counts.begin(), counts.end());
+    cout << "\n>> " << label << " (" << values.size() << " runs)" << endl;
+    for (int v = 0; v <= maxValue; v++) {
+        int bar = peak > 0 ? (int)(40LL * counts[v] / peak) : 0;
+        if (counts[v] > 0 && bar == 0) bar = 1;
+        cout << "  " << setw(3) << v << " | " << left << setw(40) << string(bar, '#') << right
+             << setw(6) << fixed << setprecision(1) << 100.0 * counts[v] / values.size() << " %" << endl;
+    }
+}
+
+// ==========================================
+// CORE: Simulation
+// One task = a block of runs of one overbooking level; the cost of a run
+// grows with the level, which is what the stealing evens out. Run r of
+// level k always uses the same seed, so results do not depend on the
+// thread count.
+// ==========================================
+template <typename System>
+void simulate(const SimConfig& cfg, const FlightImage& img) {
+    static constexpr int RUNS_PER_TASK = 16;
+
+    int demand = cfg.demand >= 0 ? cfg.demand : (int)(img.capacity * cfg.cancelRate + 0.5);
+    int threads = cfg.threads > 0 ? cfg.threads : (int)thread::hardware_concurrency();
+    if (threads < 1) threads = 1;
+
+    vector<int> levels = cfg.overbook;
+    if (levels.empty()) {
+        int top = img.capacity * 15 / 100;
+        int step = top / 10 > 0 ? top / 10 : 1;
+        for (int k = 0; k <= top; k += step) levels.push_back(k);
+    }
+
+    WorkStealingPool pool(threads);
+    vector<unique_ptr<OverbookRunner<System>>> runners;
+    int blocks = (cfg.runs + RUNS_PER_TASK - 1) / RUNS_PER_TASK;
+    vector<vector<RunResult>> results(levels.size(), vector<RunResult>(cfg.runs));
+
+    Timer t;
+    long long rebuildMicros = 0; // One system built from the image (what a clone would cost without undo)
+    long long cloneNs = 0, replayNs = 0;
+    {
+        QuietScope quiet;
+        Timer build;
+        build.start();
+        runners.emplace_back(new OverbookRunner<System>(img));
+        build.stop();
+        rebuildMicros = build.getDurationInMicroseconds();
+        for (int w = 1; w < pool.size(); w++) runners.emplace_back(new OverbookRunner<System>(img));
+        t.start();
+        pool.run((int)levels.size() * blocks, [&](int task, int worker) {
+            int level = task / blocks;
+            int first = (task % blocks) * RUNS_PER_TASK;
+            int last = min(first + RUNS_PER_TASK, cfg.runs);
+            for (int run = first; run < last; run++) {
+                uint64_t seed = cfg.seed * 0x9E3779B97F4A7C15ULL + ((uint64_t)levels[level] << 32) + (uint64_t)run;
+                results[level][run] = runners[worker]->run(cfg, levels[level], demand, seed);
+            }
+        });
+        t.stop();
+
+        for (auto& r : runners) {
+            cloneNs += r->cloneNanos();
+            replayNs += r->replayNanos();
+        }
+        runners.clear(); // System destructors print: still inside the quiet scope
+    }
+    long long totalRuns = (long long)levels.size() * cfg.runs;
+
+    cout << ">> " << totalRuns << " runs (" << levels.size() << " levels x " << cfg.runs << ") on " << pool.size()
+         << " threads in " << t.getDurationInMilliseconds() << " ms, " << pool.steals() << " tasks stolen." << endl;
+    cout << ">> Per run: clone " << fixed << setprecision(1) << cloneNs / 1000.0 / totalRuns << " us (undo + waitlist), replay "
+         << replayNs / 1000.0 / totalRuns << " us; building the flight from scratch: " << rebuildMicros << " us." << endl;
+    cout << ">> Cancel " << cfg.cancelRate * 100 << " %, no-show " << cfg.noShowRate * 100 << " %, "
+         << demand << " new requests per run, cost " << cfg.deniedCost << " per denied boarding / "
+         << cfg.emptyCost << " per empty seat." << endl;
+
+    cout << "\n  Overbook |        Denied boardings         |        Empty seats        |  Mean" << endl;
+    cout << "   +K      |  mean  p50  p90  p99  max  P(>0)|  mean  p50  p90  p99  max |  cost" << endl;
+    int best = 0;
+    double bestCost = 0;
+    vector<Distribution> denied(levels.size());
+    for (size_t i = 0; i < levels.size(); i++) {
+        vector<int> d, e;
+        for (const RunResult& r : results[i]) {
+            d.push_back(r.denied);
+            e.push_back(r.empty);
+        }
+        Distribution dd = summarize(d);
+        Distribution ed = summarize(e);
+        double cost = cfg.deniedCost * dd.mean + cfg.emptyCost * ed.mean;
+        if (i == 0 || cost < bestCost) {
+            best = (int)i;
+            bestCost = cost;
+        }
+        cout << "  " << setw(6) << levels[i] << "   |" << setprecision(2) << setw(6) << dd.mean << setw(5) << dd.p50
+             << setw(5) << dd.p90 << setw(5) << dd.p99 << setw(5) << dd.max << setprecision(1) << setw(6) << dd.positive << "%|"
+             << setprecision(2) << setw(6) << ed.mean << setw(5) << ed.p50 << setw(5) << ed.p90 << setw(5) << ed.p99
+             << setw(5) << ed.max << " |" << setw(6) << cost << endl;
+    }
+
+    cout << "\n>> Lowest expected cost: sell " << levels[best] << " tickets over the " << img.capacity << " seats." << endl;
+    vector<int> d;
+    for (const RunResult& r : results[best]) d.push_back(r.denied);
+    printHistogram(d, "Denied boardings at +" + to_string(levels[best]));
+}
+
+int main(int argc, char* argv[]) {
+    SimConfig cfg;
+    if (!parseArgs(argc, argv, cfg)) return 1;
+    Log::setLevel(Log::OFF);
+
+    FlightImage img;
+    if (!captureImage(cfg.csvFile, img)) {
+        cerr << ">> [Error] No passengers loaded from " << cfg.csvFile << endl;
+        return 1;
+    }
+    cout << ">> Flight: " << cfg.csvFile << " - " << img.seated.size() << " seated of " << img.capacity << " seats ("
+         << img.seats[CLASS_FIRST] << " First, " << img.seats[CLASS_BUSINESS] << " Business, " << img.seats[CLASS_ECONOMY]
+         << " Economy), " << img.waiting.size() << " on the waitlist." << endl;
+    cout << ">> System: " << cfg.systemName << endl;
+
+    if (cfg.systemName == "list") simulate<LinkedListSystem>(cfg, img);
+    else simulate<ArraySystem>(cfg, img);
+    return 0;
+}
@@ -0,0 +1,121 @@
+#ifndef ROWBUCKETINDEX_HPP
+#define ROWBUCKETINDEX_HPP
+
+#include <vector>
+#include <cstdint>
+
+#include "AircraftLayout.hpp"
+
+using namespace std;
+
+struct Passenger;
+
+// ==========================================
+// CLASS: RowBucketIndex
+// Description: Per-row buckets of seated passengers for range queries
+// ("rows 11-20", "all Business", "every window seat in column A").
+// 1. Bucket per row: one Passenger* slot per column + occupancy word.
+// 2. Bitmap of non-empty rows, and one row bitmap per column.
+// 3. Class buckets = the class's row range from the aircraft layout.
+// A query only visits 64-row words of the range and the set bits inside
+// them, so cost grows with the number of passengers returned.
+// Maintained by the systems on add / remove.
+// ==========================================
+class RowBucketIndex {
+private:
+    int rows = 0;
+    int cols = 0;
+    vector<Passenger*> seats;              // [(row - 1) * cols + col]
+    vector<uint32_t> rowMask;              // [row] -> occupied columns
+    vector<uint64_t> nonEmptyRows;         // bit r = row r has a passenger
+    vector<vector<uint64_t>> columnRows;   // [col] bit r = seat (r, col) taken
+    int classStart[CLASS_COUNT] = { 0, 0, 0 };
+    int classEnd[CLASS_COUNT] = { -1, -1, -1 };
+
+    static void setBit(vector<uint64_t>& words, int r, bool on) {
+        if (on) words[r >> 6] |= 1ULL << (r & 63);
+        else words[r >> 6] &= ~(1ULL << (r & 63));
+    }
+
+    // Calls f(row) for every set bit r in [from, to]
+    template <typename F>
+    static void forEachBit(const vector<uint64_t>& words, int from, int to, F f) {
+        if (from > to) return;
+        for (int w = from >> 6; w <= (to >> 6); w++) {
+            uint64_t word = words[w];
+            if (w == (from >> 6)) word &= ~0ULL << (from & 63);
+            if (w == (to >> 6) && (to & 63) != 63) word &= (1ULL << ((to & 63) + 1)) - 1;
+            while (word) {
+                f((w << 6) + __builtin_ctzll(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+public:
+    void reset(const AircraftLayout& layout) {
+        rows = layout.totalRows;
+        cols = layout.cols;
+        seats.assign((size_t)rows * cols, nullptr);
+        rowMask.assign(rows + 1, 0);
+        nonEmptyRows.assign((rows >> 6) + 1, 0);
+        columnRows.assign(cols, vector<uint64_t>((rows >> 6) + 1, 0));
+        for (int c = 0; c < CLASS_COUNT; c++) {
+            classStart[c] = layout.classStart[c];
+            classEnd[c] = layout.classEnd[c] < rows ? layout.classEnd[c] : rows;
+        }
+    }
+
+    bool inCabin(int row, int col) const { return row >= 1 && row <= rows && col >= 0 && col < cols; }
+
+    // Function: Put a passenger in its row bucket (overwrites the slot)
+    void place(Passenger* p, int row, int col) {
+        if (!inCabin(row, col)) return;
+        seats[(size_t)(row - 1) * cols + col] = p;
+        rowMask[row] |= 1u << col;
+        setBit(nonEmptyRows, row, true);
+        setBit(columnRows[col], row, true);
+    }
+
+    // Function: Empty a seat slot
+    void clear(int row, int col) {
+        if (!inCabin(row, col)) return;
+        seats[(size_t)(row - 1) * cols + col] = nullptr;
+        rowMask[row] &= ~(1u << col);
+        if (rowMask[row] == 0) setBit(nonEmptyRows, row, false);
+        setBit(columnRows[col], row, false);
+    }
+
+    Passenger* at(int row, int col) const {
+        return inCabin(row, col) ? seats[(size_t)(row - 1) * cols + col] : nullptr;
+    }
+
+    // Function: Query
+    // Rows [fromRow, toRow], optionally only class 'cls' (CLASS_NONE = any)
+    // and only column 'col' (-1 = any). Results are in seat order.
+    vector<Passenger*> query(int fromRow, int toRow, int cls, int col) const {
+        vector<Passenger*> out;
+        if (fromRow < 1) fromRow = 1;
+        if (toRow > rows) toRow = rows;
+        if (cls >= 0 && cls < CLASS_COUNT) {
+            if (classStart[cls] > fromRow) fromRow = classStart[cls];
+            if (classEnd[cls] < toRow) toRow = classEnd[cls];
+        }
+        if (fromRow > toRow || col >= cols) return out;
+
+        if (col >= 0) {
+            forEachBit(columnRows[col], fromRow, toRow, [&](int r) {
+                out.push_back(seats[(size_t)(r - 1) * cols + col]);
+            });
+        } else {
+            forEachBit(nonEmptyRows, fromRow, toRow, [&](int r) {
+                for (uint32_t m = rowMask[r]; m; m &= m - 1) {
+                    out.push_back(seats[(size_t)(r - 1) * cols + __builtin_ctz(m)]);
+                }
+            });
+        }
+        return out;
+    }
+};
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef SCANPOOL_HPP
+#define SCANPOOL_HPP
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+#include "IDScan.hpp"
+
+using namespace std;
+
+// ==========================================
+// CLASS: ScanPool
+// Description: Small fixed pool of worker threads for splitting one scan
+// into parts. run(parts, job) hands part 0 to the calling thread and
+// parts 1..N-1 to the workers, then waits for all of them. Threads are
+// started on first use and sleep on a condition variable between scans.
+// ==========================================
+class ScanPool {
+private:
+    vector<thread> workers;
+    mutex lock;
+    condition_variable wake;
+    condition_variable finished;
+    const function<void(int)>* job = nullptr; // Valid while run() waits
+    int parts = 0;
+    int pending = 0;           // Worker parts of the current scan not yet done
+    unsigned generation = 0;   // Bumped per scan so each worker runs once
+    bool stopping = false;
+    int threadCount;
+
+    void workerLoop(int part) {
+        unsigned seen = 0;
+        while (true) {
+            const function<void(int)>* task;
+            {
+                unique_lock<mutex> guard(lock);
+                wake.wait(guard, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+                if (part >= parts) continue; // Not needed for this scan
+                task = job;
+            }
+            (*task)(part);
+            {
+                lock_guard<mutex> guard(lock);
+                if (--pending == 0) finished.notify_one();
+            }
+        }
+    }
+
+    void start() {
+        for (int part = 1; part < threadCount; part++) workers.emplace_back(&ScanPool::workerLoop, this, part);
+    }
+
+public:
+    explicit ScanPool(int threads) : threadCount(threads < 1 ? 1 : threads) {}
+
+    ~ScanPool() {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (thread& t : workers) t.join();
+    }
+
+    int size() const { return threadCount; }
+
+    // Function: Run job(0) .. job(n - 1) in parallel (n <= size()), return when all are done
+    void run(int n, const function<void(int)>& f) {
+        if (n > threadCount) n = threadCount;
+        if (n <= 1) {
+            f(0);
+            return;
+        }
+        if (workers.empty()) start();
+        {
+            lock_guard<mutex> guard(lock);
+            job = &f;
+            parts = n;
+            pending = n - 1;
+            generation++;
+        }
+        wake.notify_all();
+        f(0);
+        unique_lock<mutex> guard(lock);
+        finished.wait(guard, [&] { return pending == 0; });
+    }
+};
+
+// ==========================================
+// FUNCTION: Parallel ID Key Scan
+// Splits keys[0, n) into one range per thread; each range is scanned in
+// short strides with the IDScan kernel and stops as soon as any thread
+// has confirmed a match. confirm(i) rejects key matches that are not the
+// real ID (long IDs can share a key, empty slots hold 0).
+// Returns a confirmed index or -1.
+// ==========================================
+template <typename Confirm>
+int parallelFindKey(ScanPool& pool, const uint64_t* keys, int n, uint64_t key, Confirm confirm) {
+    static constexpr int STRIDE = 4096; // Keys between checks of the "found" flag
+    atomic<int> found(-1);
+    int parts = pool.size();
+    int chunk = (n + parts - 1) / parts;
+
+    pool.run(parts, [&](int part) {
+        int begin = part * chunk;
+        int end = begin + chunk < n ? begin + chunk : n;
+        for (int from = begin; from < end && found.load(memory_order_relaxed) == -1; from += STRIDE) {
+            int to = from + STRIDE < end ? from + STRIDE : end;
+            for (int i = IDScan::find(keys, to, key, from); i != -1; i = IDScan::find(keys, to, key, i + 1)) {
+                if (confirm(i)) {
+                    found.store(i, memory_order_relaxed);
+                    return;
+                }
+            }
+        }
+    });
+    return found.load();
+}
+
+#endif
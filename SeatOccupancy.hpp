@@ -0,0 +1,290 @@
+#ifndef SEATOCCUPANCY_HPP
+#define SEATOCCUPANCY_HPP
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+#include "AircraftLayout.hpp"
+
+using namespace std;
+
+// Seat preference for automatic allocation
+enum SeatPreference {
+    SEAT_ANY = 0,
+    SEAT_WINDOW = 1,
+    SEAT_AISLE = 2,
+    SEAT_PREF_COUNT = 3
+};
+
+// ==========================================
+// CLASS: SeatOccupancy
+// Description: Bitmask view of which seats are taken.
+// 1. One 32-bit word per row: bit c = seat (row, c) is occupied.
+// 2. Per-class summary bitmaps: bit r = row r still has a free seat
+//    (one bitmap for "any seat", one for window, one for aisle).
+// 3. Free-seat counters per class.
+// 4. Two-level bitmap of rows with a taken seat: the highest occupied row
+//    is two clz instructions for cabins up to 4096 rows.
+// "First free seat in class X" = ctz over the summary words, then ctz over
+// the row word, instead of scanning seat by seat.
+// Maintained by the systems on every seat assignment / release.
+// ==========================================
+class SeatOccupancy {
+private:
+    int rows = 0;
+    int cols = 0;
+    vector<uint32_t> occupied;   // [row] -> taken seats
+    vector<uint32_t> sellable;   // [row] -> seats that exist and are not blocked
+    vector<unsigned char> rowClass;
+    uint32_t prefMask[SEAT_PREF_COUNT] = { 0, 0, 0 };
+    vector<uint32_t> blocks;     // One mask per aisle block (e.g. ABC | DEF)
+
+    // summary[pref][class][word] -> bit (row % 64) = row has a free seat matching pref
+    vector<uint64_t> summary[SEAT_PREF_COUNT][CLASS_COUNT];
+    int freeCount[CLASS_COUNT] = { 0, 0, 0 };
+    int capacity[CLASS_COUNT] = { 0, 0, 0 };  // Sellable seats per class
+    vector<uint64_t> usedRows;   // bit r = row r has a taken seat
+    vector<uint64_t> usedWords;  // bit w = usedRows[w] != 0
+
+    // Refresh the summary bits of one row after its occupancy changed
+    void updateSummary(int row) {
+        uint64_t& used = usedRows[row >> 6];
+        if (occupied[row] != 0) used |= 1ULL << (row & 63);
+        else used &= ~(1ULL << (row & 63));
+        int w = row >> 6;
+        if (used != 0) usedWords[w >> 6] |= 1ULL << (w & 63);
+        else usedWords[w >> 6] &= ~(1ULL << (w & 63));
+
+        int cls = rowClass[row];
+        if (cls >= CLASS_COUNT) return;
+        uint32_t freeSeats = sellable[row] & ~occupied[row];
+        uint64_t bit = 1ULL << (row & 63);
+        for (int p = 0; p < SEAT_PREF_COUNT; p++) {
+            uint64_t& word = summary[p][cls][row >> 6];
+            if (freeSeats & prefMask[p]) word |= bit;
+            else word &= ~bit;
+        }
+    }
+
+public:
+    SeatOccupancy() {}
+    explicit SeatOccupancy(const AircraftLayout& layout) { reset(layout); }
+
+    // Function: Reset to an empty cabin for the given layout
+    void reset(const AircraftLayout& layout) {
+        rows = layout.totalRows;
+        cols = layout.cols;
+        occupied.assign(rows + 1, 0);
+        sellable.assign(rows + 1, 0);
+        rowClass.assign(rows + 1, CLASS_NONE);
+
+        uint32_t allCols = (cols >= 32) ? 0xFFFFFFFFu : ((1u << cols) - 1);
+        prefMask[SEAT_ANY] = allCols;
+        prefMask[SEAT_WINDOW] = (1u | (1u << (cols - 1))) & allCols;
+        prefMask[SEAT_AISLE] = 0;
+        for (int c = 0; c < cols - 1; c++) {
+            if (layout.aisleAfter(c)) prefMask[SEAT_AISLE] |= (1u << c) | (1u << (c + 1));
+        }
+
+        // Split the row into aisle blocks: a group never straddles an aisle
+        blocks.clear();
+        uint32_t block = 0;
+        for (int c = 0; c < cols; c++) {
+            block |= 1u << c;
+            if (layout.aisleAfter(c) || c == cols - 1) { blocks.push_back(block); block = 0; }
+        }
+
+        int words = (rows >> 6) + 1;
+        for (int p = 0; p < SEAT_PREF_COUNT; p++)
+            for (int c = 0; c < CLASS_COUNT; c++) summary[p][c].assign(words, 0);
+        for (int c = 0; c < CLASS_COUNT; c++) freeCount[c] = 0;
+        usedRows.assign(words, 0);
+        usedWords.assign((words >> 6) + 1, 0);
+
+        for (int r = 1; r <= rows; r++) {
+            sellable[r] = allCols & ~layout.blockedMask[r];
+            rowClass[r] = (unsigned char)layout.classOfRow(r);
+            if (rowClass[r] < CLASS_COUNT) freeCount[rowClass[r]] += __builtin_popcount(sellable[r]);
+            updateSummary(r);
+        }
+        for (int c = 0; c < CLASS_COUNT; c++) capacity[c] = freeCount[c];
+    }
+
+    bool inCabin(int row, int col) const { return row >= 1 && row <= rows && col >= 0 && col < cols; }
+
+    bool isFree(int row, int col) const {
+        return inCabin(row, col) && ((sellable[row] & ~occupied[row]) >> col & 1u);
+    }
+
+    // Function: Mark seat taken (returns false if it was not free)
+    bool occupy(int row, int col) {
+        if (!isFree(row, col)) return false;
+        occupied[row] |= 1u << col;
+        if (rowClass[row] < CLASS_COUNT) freeCount[rowClass[row]]--;
+        updateSummary(row);
+        return true;
+    }
+
+    // Function: Mark seat free again (returns false if it was not taken)
+    bool release(int row, int col) {
+        if (!inCabin(row, col) || !(occupied[row] >> col & 1u)) return false;
+        occupied[row] &= ~(1u << col);
+        if (rowClass[row] < CLASS_COUNT) freeCount[rowClass[row]]++;
+        updateSummary(row);
+        return true;
+    }
+
+    // Bits of the free seats in one row
+    uint32_t freeMask(int row) const {
+        if (row < 1 || row > rows) return 0;
+        return sellable[row] & ~occupied[row];
+    }
+
+    uint32_t occupiedMask(int row) const {
+        if (row < 1 || row > rows) return 0;
+        return occupied[row];
+    }
+
+    int countFree(int cls) const {
+        return (cls >= 0 && cls < CLASS_COUNT) ? freeCount[cls] : 0;
+    }
+
+    // Taken seats of a class (passengers + anything else marked occupied)
+    int countTaken(int cls) const {
+        return (cls >= 0 && cls < CLASS_COUNT) ? capacity[cls] - freeCount[cls] : 0;
+    }
+
+    // Highest row with a taken seat, 0 if the cabin is empty
+    int highestTakenRow() const {
+        for (int s = (int)usedWords.size() - 1; s >= 0; s--) {
+            if (usedWords[s] == 0) continue;
+            int w = (s << 6) + 63 - __builtin_clzll(usedWords[s]);
+            return (w << 6) + 63 - __builtin_clzll(usedRows[w]);
+        }
+        return 0;
+    }
+
+    int rowCount() const { return rows; }
+    int colCount() const { return cols; }
+
+    // Function: Next row (>= fromRow) of class 'cls' with a free seat matching 'pref'
+    // Returns -1 if there is none.
+    int nextFreeRow(int cls, int pref, int fromRow) const {
+        if (cls < 0 || cls >= CLASS_COUNT || fromRow > rows) return -1;
+        if (fromRow < 1) fromRow = 1;
+        const vector<uint64_t>& words = summary[pref][cls];
+        int w = fromRow >> 6;
+        uint64_t word = words[w] & (~0ULL << (fromRow & 63));
+        while (true) {
+            if (word) {
+                int row = (w << 6) + __builtin_ctzll(word);
+                return row <= rows ? row : -1;
+            }
+            if (++w >= (int)words.size()) return -1;
+            word = words[w];
+        }
+    }
+
+    // ==========================================
+    // GROUP SEATING (K adjacent seats)
+    // ==========================================
+
+    // Bit i of the result = seats i .. i+k-1 are all set in m.
+    // Uses shift-and doubling: O(log k) word operations.
+    static uint32_t runStarts(uint32_t m, int k) {
+        int have = 1;
+        while (have < k && m) {
+            int step = (have * 2 <= k) ? have : k - have;
+            m &= m >> step;
+            have += step;
+        }
+        return m;
+    }
+
+    // Function: K contiguous free seats in one aisle block of a row
+    // Returns the seat mask (0 if the row cannot hold the group).
+    uint32_t findRunInRow(int row, int k) const {
+        uint32_t freeSeats = freeMask(row);
+        if (k <= 0 || __builtin_popcount(freeSeats) < k) return 0; // Quick reject (nearly full rows)
+        for (uint32_t block : blocks) {
+            uint32_t starts = runStarts(freeSeats & block, k);
+            if (starts) return ((1u << k) - 1) << __builtin_ctz(starts);
+        }
+        return 0;
+    }
+
+    // Function: Longest contiguous free run (within one aisle block) of a row, capped at 'limit'
+    uint32_t longestRunInRow(int row, int limit) const {
+        uint32_t best = 0;
+        int bestLen = 0;
+        for (int len = limit; len > 0 && bestLen == 0; len--) {
+            uint32_t seats = findRunInRow(row, len);
+            if (seats) { best = seats; bestLen = len; }
+        }
+        return best;
+    }
+
+    // Function: Find Seats for a Group
+    // 1. Lowest row of the class with K adjacent free seats in one aisle block.
+    // 2. Otherwise: a band of consecutive rows, each contributing its longest
+    //    free run, until K seats are collected.
+    // Only rows with a free seat are visited (summary bitmap), so a nearly full
+    // cabin costs O(free rows), not O(seats).
+    // Output: (row, col) pairs, empty if the group does not fit together.
+    bool findGroupSeats(int cls, int k, vector<pair<int, int>>& seats) const {
+        seats.clear();
+        if (k <= 0 || cls < 0 || cls >= CLASS_COUNT || countFree(cls) < k) return false;
+
+        // Pass 1: whole group in one row
+        if (k <= cols) {
+            for (int r = nextFreeRow(cls, SEAT_ANY, 1); r != -1; r = nextFreeRow(cls, SEAT_ANY, r + 1)) {
+                uint32_t run = findRunInRow(r, k);
+                if (run) {
+                    for (uint32_t m = run; m; m &= m - 1) seats.push_back(make_pair(r, __builtin_ctz(m)));
+                    return true;
+                }
+            }
+        }
+
+        // Pass 2: adjacent rows (front to back)
+        for (int r = nextFreeRow(cls, SEAT_ANY, 1); r != -1; r = nextFreeRow(cls, SEAT_ANY, r + 1)) {
+            seats.clear();
+            int needed = k;
+            for (int band = r; band <= rows && rowClass[band] == cls && needed > 0; band++) {
+                uint32_t run = longestRunInRow(band, needed < cols ? needed : cols);
+                if (!run) break; // Gap row: the band is no longer adjacent
+                for (uint32_t m = run; m; m &= m - 1) seats.push_back(make_pair(band, __builtin_ctz(m)));
+                needed -= __builtin_popcount(run);
+            }
+            if (needed == 0) return true;
+        }
+        seats.clear();
+        return false;
+    }
+
+    // Function: Best Available Seat
+    // Lowest row of the class with a seat matching the preference; falls back to
+    // any free seat of the class if no preferred seat is left.
+    bool findFree(int cls, int pref, int& row, int& col) const {
+        if (pref < 0 || pref >= SEAT_PREF_COUNT) pref = SEAT_ANY;
+        int r = nextFreeRow(cls, pref, 1);
+        if (r == -1 && pref != SEAT_ANY) {
+            pref = SEAT_ANY;
+            r = nextFreeRow(cls, pref, 1);
+        }
+        if (r == -1) return false;
+        uint32_t candidates = freeMask(r) & prefMask[pref];
+        row = r;
+        col = __builtin_ctz(candidates);
+        return true;
+    }
+};
+
+inline string seatPreferenceName(int pref) {
+    if (pref == SEAT_WINDOW) return "Window";
+    if (pref == SEAT_AISLE) return "Aisle";
+    return "Any";
+}
+
+#endif
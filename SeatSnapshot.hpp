@@ -0,0 +1,168 @@
+#ifndef SEATSNAPSHOT_HPP
+#define SEATSNAPSHOT_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+
+using namespace std;
+
+// One seat as readers see it (label empty = free seat)
+struct SnapshotSeat {
+    string id;          // Passenger ID, empty if nobody is seated (free or held)
+    string label;       // What the seat map shows: passenger name, "(HOLD)"...
+    string flightClass;
+};
+
+// ==========================================
+// CLASS: SeatSnapshot
+// Description: Immutable view of the seat grid (seat -> passenger) at one
+// moment. Rows are the leaves of an 8-way tree of shared, read-only nodes,
+// so a new snapshot shares every row that did not change with the old one.
+// Seats are shared too (a row copy only copies pointers). Readers keep a
+// snapshot alive through its shared_ptr; nothing in it is ever modified,
+// so they read the seats without locks.
+// ==========================================
+class SeatSnapshot {
+public:
+    static constexpr int FAN_BITS = 3;
+    static constexpr int FAN = 1 << FAN_BITS;
+
+    struct Node {
+        shared_ptr<const Node> kids[FAN];            // Branch
+        vector<shared_ptr<const SnapshotSeat>> seats; // Leaf: one row (nullptr = free)
+    };
+
+private:
+    shared_ptr<const Node> root;
+    int depth = 0;       // Branch levels above the rows
+    int rowCount = 0;
+    int colCount = 0;
+    int seatedCount = 0;
+    long long versionNo = 0;
+
+    friend class SnapshotPublisher;
+
+    const Node* leaf(int row) const { // row: 0-based
+        const Node* n = root.get();
+        for (int level = depth; level > 0; level--) {
+            n = n->kids[(row >> (FAN_BITS * (level - 1))) & (FAN - 1)].get();
+        }
+        return n;
+    }
+
+    static const SnapshotSeat& seatOf(const shared_ptr<const SnapshotSeat>& seat) {
+        static const SnapshotSeat freeSeat;
+        return seat ? *seat : freeSeat;
+    }
+
+    template <typename F>
+    void walk(const Node* n, int level, int firstRow, F& f) const {
+        if (level == 0) {
+            if (firstRow >= rowCount) return;
+            for (int c = 0; c < colCount; c++) f(firstRow + 1, c, seatOf(n->seats[c]));
+            return;
+        }
+        int span = 1 << (FAN_BITS * (level - 1));
+        for (int k = 0; k < FAN && firstRow + k * span < rowCount; k++) {
+            walk(n->kids[k].get(), level - 1, firstRow + k * span, f);
+        }
+    }
+
+public:
+    int rows() const { return rowCount; }
+    int cols() const { return colCount; }
+    int seated() const { return seatedCount; }
+    long long version() const { return versionNo; } // Seat changes published so far
+
+    // Seat at (row 1-based, column index)
+    const SnapshotSeat& at(int row, int cIndex) const { return seatOf(leaf(row - 1)->seats[cIndex]); }
+
+    // Function: f(row, cIndex, seat) for every seat in row order (one tree walk)
+    template <typename F>
+    void forEachSeat(F f) const { walk(root.get(), depth, 0, f); }
+};
+
+// ==========================================
+// CLASS: SnapshotPublisher
+// Description: Writer side of the seat snapshots (RCU style).
+// 1. setSeat / clearSeat copy the changed row and the O(log8 rows)
+//    branches above it (path copying); every other node stays shared.
+// 2. publish() swaps the new root in with std::atomic_store. Readers that
+//    still hold an older snapshot keep it; its nodes are freed when the
+//    last reader lets go.
+// atomic_load / atomic_store on a shared_ptr are not lock-free in libstdc++
+// (atomic_is_lock_free is false): both take a small internal spinlock for
+// the pointer copy and reference count. Readers hold it only while they
+// copy the root, never while they read the seats.
+// Single writer (the owning system); any number of reader threads.
+// ==========================================
+class SnapshotPublisher {
+private:
+    typedef SeatSnapshot::Node Node;
+
+    SeatSnapshot draft;                       // Writer's latest state (unpublished changes)
+    shared_ptr<const SeatSnapshot> published; // Read with atomic_load / written with atomic_store (short internal lock)
+
+    // Copy the path down to 'row' and replace one seat in the copied leaf
+    shared_ptr<const Node> update(const shared_ptr<const Node>& node, int level, int row, int cIndex, const shared_ptr<const SnapshotSeat>& seat) {
+        shared_ptr<Node> copy = make_shared<Node>(*node);
+        if (level == 0) {
+            copy->seats[cIndex] = seat;
+        } else {
+            int k = (row >> (SeatSnapshot::FAN_BITS * (level - 1))) & (SeatSnapshot::FAN - 1);
+            copy->kids[k] = update(node->kids[k], level - 1, row, cIndex, seat);
+        }
+        return copy;
+    }
+
+public:
+    SnapshotPublisher() { reset(0, 0); }
+
+    // Function: All seats free. Every row (and every branch) starts as the
+    // same shared empty node, so this is O(depth), not O(seats).
+    void reset(int rows, int cols) {
+        int depth = 0;
+        while ((1LL << (SeatSnapshot::FAN_BITS * depth)) < rows) depth++;
+
+        shared_ptr<Node> node = make_shared<Node>();
+        node->seats.assign(cols, nullptr);
+        for (int level = 1; level <= depth; level++) {
+            shared_ptr<Node> branch = make_shared<Node>();
+            for (int k = 0; k < SeatSnapshot::FAN; k++) branch->kids[k] = node;
+            node = branch;
+        }
+        draft.root = node;
+        draft.depth = depth;
+        draft.rowCount = rows;
+        draft.colCount = cols;
+        draft.seatedCount = 0;
+        draft.versionNo = 0;
+        publish();
+    }
+
+    void setSeat(int row, int cIndex, const string& id, const string& label, const string& fclass) {
+        if (row < 1 || row > draft.rowCount || cIndex < 0 || cIndex >= draft.colCount) return;
+        const SnapshotSeat& old = draft.at(row, cIndex);
+        draft.seatedCount += (id.empty() ? 0 : 1) - (old.id.empty() ? 0 : 1);
+        shared_ptr<const SnapshotSeat> seat;
+        if (!label.empty()) seat = make_shared<SnapshotSeat>(SnapshotSeat{ id, label, fclass });
+        draft.root = update(draft.root, draft.depth, row - 1, cIndex, seat);
+        draft.versionNo++;
+    }
+
+    void clearSeat(int row, int cIndex) { setSeat(row, cIndex, "", "", ""); }
+
+    // Function: Make the changes so far visible to readers (one small
+    // allocation + atomic_store of the root)
+    void publish() {
+        atomic_store(&published, shared_ptr<const SeatSnapshot>(make_shared<SeatSnapshot>(draft)));
+    }
+
+    // Reader entry point, safe from any thread: only the root copy goes
+    // through atomic_load (and its internal lock); the seat data is never locked
+    shared_ptr<const SeatSnapshot> current() const { return atomic_load(&published); }
+};
+
+#endif
@@ -0,0 +1,545 @@
+#include "FlightCommon.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_set>
+#include <unordered_map>
+
+using namespace std;
+
+// ==========================================
+// NODE: SkipNode (Skip List Node)
+// One passenger plus 'level' forward pointers (level 0 = the full list
+// in ID order, higher levels skip ahead).
+// ==========================================
+struct SkipNode {
+    Passenger rec;
+    int level;
+    SkipNode** forward;
+
+    explicit SkipNode(int lvl) : level(lvl) {
+        forward = new SkipNode*[lvl];
+        for (int i = 0; i < lvl; i++) forward[i] = nullptr;
+    }
+    ~SkipNode() { delete[] forward; }
+};
+
+// ==========================================
+// CLASS: SkipListSystem
+// Description: Implements the Flight System with a Skip List keyed by
+// passenger ID.
+// Key Features:
+// 1. O(log N) expected insert / delete / search (levels promoted with p = 1/4).
+// 2. Level 0 is always in ID order: sortByID has nothing left to do.
+// 3. Singly Linked List for Waitlist (Requirement), with the same auto-fill
+//    as ArraySystem: a freed seat goes to the head of the waitlist.
+// ==========================================
+class SkipListSystem final : public FlightSystem {
+private:
+    static constexpr int MAX_LEVEL = 16; // Enough for 4^16 passengers at p = 1/4
+
+    SkipNode* header;        // Sentinel: forward[i] = first node of level i
+    int listLevel;           // Highest level in use
+    int currentCount;        // Total passengers
+    uint32_t rngState;       // xorshift state for node levels
+    SeatOccupancy occupancy; // Bitmask view of taken seats (free-seat finder)
+    WaitlistTally waitTally; // Waitlist depth per class (stats)
+    ChangeFeed feed;         // Event stream of reservation changes
+    NameIndex nameIndex;     // Name search index (seated + waitlisted)
+    RowBucketIndex buckets;  // Per-row buckets of seated passengers (range queries)
+
+    // --- Waitlist Variables (Singly Linked List) ---
+    WaitlistNode* waitlistHead;
+    WaitlistNode* waitlistTail;
+
+    // ==========================================
+    // HELPER: Skip List Core
+    // ==========================================
+
+    // Function: Random level, P(level > k) = 4^-k
+    int randomLevel() {
+        int lvl = 1;
+        while (lvl < MAX_LEVEL) {
+            rngState ^= rngState << 13;
+            rngState ^= rngState >> 17;
+            rngState ^= rngState << 5;
+            if ((rngState & 3) != 0) break;
+            lvl++;
+        }
+        return lvl;
+    }
+
+    // Function: Find the node with this ID (nullptr if absent)
+    // update[i] (optional) receives the last node before the ID on level i.
+    SkipNode* findNode(const string& id, SkipNode** update = nullptr) const {
+        SkipNode* x = header;
+        for (int i = listLevel - 1; i >= 0; i--) {
+            while (x->forward[i] != nullptr && x->forward[i]->rec.passengerID < id) x = x->forward[i];
+            if (update != nullptr) update[i] = x;
+        }
+        x = x->forward[0];
+        return (x != nullptr && x->rec.passengerID == id) ? x : nullptr;
+    }
+
+    // Function: Unlink a node found with findNode(id, update) and free it
+    void eraseNode(SkipNode* node, SkipNode** update) {
+        for (int i = 0; i < listLevel; i++) {
+            if (update[i]->forward[i] != node) break;
+            update[i]->forward[i] = node->forward[i];
+        }
+        while (listLevel > 1 && header->forward[listLevel - 1] == nullptr) listLevel--;
+
+        int cIndex = FlightGlobal::getColIndex(node->rec.seatCol);
+        occupancy.release(node->rec.seatRow, cIndex);
+        buckets.clear(node->rec.seatRow, cIndex);
+        nameIndex.remove(node->rec.passengerID, false);
+        feed.publish(CHANGE_SEAT_REMOVE, node->rec.passengerID, node->rec.name, node->rec.seatRow, node->rec.seatCol, node->rec.flightClass);
+        delete node;
+        currentCount--;
+    }
+
+    // Function: Print seated passengers in the given order, then the waitlist
+    void printManifest(const vector<Passenger*>& order) {
+        if (order.empty()) {
+            cout << ">> [Manifest] List is empty." << endl;
+        } else {
+            cout << "\n==============================================================" << endl;
+            cout << "             PASSENGER MANIFEST (SKIP LIST)" << endl;
+            cout << "==============================================================" << endl;
+            cout << left << setw(10) << "ID"
+                 << left << setw(20) << "Name"
+                 << left << setw(10) << "Seat"
+                 << left << setw(15) << "Class" << endl;
+            cout << "--------------------------------------------------------------" << endl;
+            for (Passenger* p : order) {
+                cout << left << setw(10) << p->passengerID
+                     << left << setw(20) << p->name
+                     << left << setw(10) << (to_string(p->seatRow) + p->seatCol)
+                     << left << setw(15) << p->flightClass << endl;
+            }
+        }
+
+        cout << "\n------------------ WAITLIST (Singly Linked List) ------------------" << endl;
+        if (waitlistHead == nullptr) {
+            cout << "(Empty)" << endl;
+        } else {
+            int count = 1;
+            for (WaitlistNode* temp = waitlistHead; temp != nullptr; temp = temp->next) {
+                cout << count++ << ". " << temp->name << " (" << temp->id << ") - " << temp->flightClass << endl;
+            }
+        }
+
+        cout << "==============================================================" << endl;
+        cout << "Press Any Key + Enter to continue...";
+        string dummy; cin >> dummy;
+    }
+
+    vector<Passenger*> idOrder() const {
+        vector<Passenger*> order;
+        order.reserve(currentCount);
+        for (SkipNode* x = header->forward[0]; x != nullptr; x = x->forward[0]) order.push_back(&x->rec);
+        return order;
+    }
+
+    // --- Hooks for FlightSystem's shared seat features (auto-assign, group booking) ---
+    SeatOccupancy* seatOccupancy() override { return &occupancy; }
+
+    // Function: First group ID that already has a seat (K skip list searches)
+    string findSeatedID(const unordered_set<string>& ids) override {
+        for (const string& id : ids) {
+            if (findNode(id) != nullptr) return id;
+        }
+        return "";
+    }
+
+public:
+    // ==========================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ==========================================
+    SkipListSystem() {
+        header = new SkipNode(MAX_LEVEL);
+        listLevel = 1;
+        currentCount = 0;
+        rngState = 2463534242u;
+        occupancy.reset(FlightGlobal::layout());
+        buckets.reset(FlightGlobal::layout());
+
+        waitlistHead = nullptr;
+        waitlistTail = nullptr;
+
+        cout << ">> Skip List System Initialized." << endl;
+    }
+
+    ~SkipListSystem() {
+        SkipNode* x = header->forward[0];
+        while (x != nullptr) {
+            SkipNode* nextNode = x->forward[0];
+            delete x;
+            x = nextNode;
+        }
+        delete header;
+
+        WaitlistNode* wTemp = waitlistHead;
+        while (wTemp != nullptr) {
+            WaitlistNode* wNext = wTemp->next;
+            delete wTemp;
+            wTemp = wNext;
+        }
+
+        cout << ">> Skip List System Destroyed (Memory Freed)." << endl;
+    }
+
+    // ==========================================
+    // FUNCTION 1: Reservation (Insertion)
+    // Seat check through the occupancy bitmask, duplicate check and insert
+    // position from one skip list search: O(log N) expected.
+    // ==========================================
+    bool addPassenger(string id, string name, int row, string col, string fclass) override {
+        if (!validateSeatClass(row, fclass)) {
+            Log::error() << ">> [Error] Class Mismatch! " << fclass << " passengers cannot sit in Row " << row << ".";
+            int cls = classCode(fclass);
+            if (cls != CLASS_NONE) Log::warn() << ">> [Hint] " << fclass << " Class is " << FlightGlobal::layout().zoneText(cls) << ".";
+            else Log::warn() << ">> [Hint] Class must be First, Business or Economy.";
+            return false;
+        }
+
+        int cIndex = FlightGlobal::getColIndex(col);
+        if (cIndex == -1 || row < 1 || row > FlightGlobal::totalRows()) {
+            Log::error() << ">> [Error] Invalid Seat Position.";
+            return false;
+        }
+        if (FlightGlobal::layout().isBlocked(row, cIndex)) {
+            Log::error() << ">> [Error] Seat " << row << col << " is blocked on this aircraft.";
+            return false;
+        }
+
+        // SEAT COLLISION -> WAITLIST
+        Passenger* holder = buckets.at(row, cIndex);
+        if (holder != nullptr) {
+            Log::info() << ">> [System] Seat " << row << col << " is taken by " << holder->name
+                 << ". Adding " << name << " to Waitlist...";
+            addToWaitlist(id, name, row, col, fclass);
+            return false;
+        }
+
+        // ID UNIQUENESS CHECK + insert position
+        SkipNode* update[MAX_LEVEL];
+        if (findNode(id, update) != nullptr) {
+            Log::warn() << ">> [Failed] Passenger ID " << id << " already exists.";
+            return false;
+        }
+
+        int lvl = randomLevel();
+        if (lvl > listLevel) {
+            for (int i = listLevel; i < lvl; i++) update[i] = header;
+            listLevel = lvl;
+        }
+
+        SkipNode* node = new SkipNode(lvl);
+        node->rec.passengerID = id;
+        node->rec.name = name;
+        node->rec.seatRow = row;
+        node->rec.seatCol = FlightGlobal::getColName(cIndex);
+        node->rec.flightClass = fclass;
+        for (int i = 0; i < lvl; i++) {
+            node->forward[i] = update[i]->forward[i];
+            update[i]->forward[i] = node;
+        }
+
+        currentCount++;
+        occupancy.occupy(row, cIndex);
+        buckets.place(&node->rec, row, cIndex);
+        nameIndex.add(id, name, false);
+        feed.publish(CHANGE_SEAT_ADD, id, name, row, node->rec.seatCol, fclass);
+        return true;
+    }
+
+    // ==========================================
+    // FUNCTION 2: Cancellation (Deletion) + Waitlist Auto-Fill
+    // ==========================================
+    bool removePassenger(string id) override {
+        SkipNode* update[MAX_LEVEL];
+        SkipNode* node = findNode(id, update);
+        if (node == nullptr) return false;
+
+        int freedRow = node->rec.seatRow;
+        string freedCol = node->rec.seatCol;
+        eraseNode(node, update);
+
+        // Fill the freed seat with the first person in line for its class.
+        // A waiter leaves the line only once the booking went through.
+        int cls = FlightGlobal::layout().classOfRow(freedRow);
+        WaitlistNode* prev = nullptr;
+        for (WaitlistNode* w = cls == CLASS_NONE ? nullptr : waitlistHead; w != nullptr; prev = w, w = w->next) {
+            if (classCode(w->flightClass) != cls) continue;
+            Log::info() << ">> [Auto-Fill] Seat " << freedRow << freedCol << " freed. Moving " << w->name << " from Waitlist.";
+            if (!addPassenger(w->id, w->name, freedRow, freedCol, w->flightClass)) continue;
+
+            nameIndex.remove(w->id, true); // Indexed as seated by addPassenger
+            feed.publish(CHANGE_PROMOTE, w->id, w->name, freedRow, freedCol, w->flightClass);
+            if (prev == nullptr) waitlistHead = w->next;
+            else prev->next = w->next;
+            if (w == waitlistTail) waitlistTail = prev;
+            waitTally.leave(w->flightClass);
+            delete w;
+            break;
+        }
+        return true;
+    }
+
+    // ==========================================
+    // FUNCTION 3: Search (Skip List, then Waitlist)
+    // ==========================================
+    Passenger* searchPassenger(const string& id) override {
+        SkipNode* node = findNode(id);
+        if (node != nullptr) return &node->rec;
+
+        for (WaitlistNode* wTemp = waitlistHead; wTemp != nullptr; wTemp = wTemp->next) {
+            if (wTemp->id == id) {
+                static Passenger tempResult; // Same "static object" trick as the other systems
+                tempResult = waitlistRecord(wTemp->id, wTemp->name, wTemp->flightClass);
+                return &tempResult;
+            }
+        }
+        return nullptr;
+    }
+
+    // ==========================================
+    // FUNCTION 4: Display Map (cells read from the row buckets)
+    // ==========================================
+    void displaySeatingMap() override {
+        int maxRow = FlightGlobal::totalRows();
+        int totalPages = (maxRow + FlightGlobal::ROWS_PER_PAGE - 1) / FlightGlobal::ROWS_PER_PAGE;
+        if (totalPages < 1) totalPages = 1;
+        int currentPage = 1;
+
+        while (true) {
+            cout << string(50, '\n');
+            cout << "==========================================================================" << endl;
+            cout << "                     FLIGHT SEATING MAP (SKIP LIST)                       " << endl;
+            cout << "==========================================================================" << endl;
+            FlightGlobal::printSeatMapHeader();
+            cout << "--------------------------------------------------------------------------" << endl;
+
+            int startRow = (currentPage - 1) * FlightGlobal::ROWS_PER_PAGE;
+            int endRow = startRow + FlightGlobal::ROWS_PER_PAGE;
+            if (endRow > maxRow) endRow = maxRow;
+
+            for (int r = startRow; r < endRow; r++) {
+                int actualRow = r + 1;
+                cout << FlightGlobal::layout().rowLabel(actualRow) << setw(2) << setfill('0') << actualRow << setfill(' ') << " ";
+
+                for (int c = 0; c < FlightGlobal::cols(); c++) {
+                    Passenger* p = buckets.at(actualRow, c);
+                    string display = (p != nullptr) ? FlightGlobal::formatName(p->name) : "EMPTY";
+                    if (display.length() > 12) display = display.substr(0, 9) + "..";
+
+                    cout << "[" << left << setw(10) << display << "] ";
+                    if (FlightGlobal::layout().aisleAfter(c) && c < FlightGlobal::cols() - 1) cout << "    ";
+                }
+                cout << endl;
+            }
+
+            cout << "--------------------------------------------------------------------------" << endl;
+            cout << "PAGE " << currentPage << "/" << totalPages << " | [N]ext  [P]rev  [0] Exit: ";
+
+            string input;
+            cin >> input;
+
+            if (input == "0") break;
+            if ((input == "n" || input == "N") && currentPage < totalPages) currentPage++;
+            if ((input == "p" || input == "P") && currentPage > 1) currentPage--;
+        }
+    }
+
+    // ==========================================
+    // FUNCTION 5: Manifest (ID order = level 0 of the skip list)
+    // ==========================================
+    void displayManifest() override {
+        printManifest(idOrder());
+    }
+
+    // ==========================================
+    // ALGORITHM 1: Bubble Sort (By Name)
+    // The skip list must stay in ID order, so the bubble sort runs on a
+    // separate array of pointers used for this listing only.
+    // ==========================================
+    void sortAlphabetically() override {
+        if (currentCount < 2) {
+            cout << ">> Not enough passengers to sort." << endl;
+            return;
+        }
+        vector<Passenger*> order = idOrder();
+        for (int i = 0; i < (int)order.size() - 1; i++) {
+            bool swapped = false;
+            for (int j = 0; j < (int)order.size() - i - 1; j++) {
+                if (order[j]->name > order[j + 1]->name) {
+                    Passenger* temp = order[j];
+                    order[j] = order[j + 1];
+                    order[j + 1] = temp;
+                    swapped = true;
+                }
+            }
+            if (!swapped) break;
+        }
+        cout << ">> Sorted " << currentCount << " passengers by Name." << endl;
+        printManifest(order);
+    }
+
+    // ==========================================
+    // WAITLIST IMPLEMENTATION (Singly Linked List)
+    // ==========================================
+    void addToWaitlist(string id, string name, int row, string col, string fclass) override {
+        WaitlistNode* newNode = new WaitlistNode;
+        newNode->id = id;
+        newNode->name = name;
+        newNode->row = row;
+        newNode->col = col;
+        newNode->flightClass = fclass;
+        newNode->next = nullptr;
+        waitTally.join(fclass);
+        feed.publish(CHANGE_WAIT_JOIN, id, name, row, col, fclass);
+
+        if (waitlistHead == nullptr) {
+            waitlistHead = newNode;
+            waitlistTail = newNode;
+        } else {
+            waitlistTail->next = newNode;
+            waitlistTail = newNode;
+        }
+        nameIndex.add(id, name, true);
+        Log::info() << ">> [Waitlist] " << name << " added for seat " << row << col << ".";
+    }
+
+    bool flightStats(FlightStats& stats) override {
+        fillSeatStats(stats, occupancy);
+        waitTally.fill(stats);
+        return true;
+    }
+
+    const ChangeFeed* changeFeed() const override { return &feed; }
+    void setChangeFeed(bool on) { feed.setEnabled(on); } // Benchmark switch
+
+    // ==========================================
+    // FEATURE: Range Queries (Row Buckets)
+    // ==========================================
+    vector<Passenger*> queryPassengers(int fromRow, int toRow, int cls, int col) override {
+        return buckets.query(fromRow, toRow, cls, col);
+    }
+
+    // ==========================================
+    // FEATURE: Name Search (Prefix / Fuzzy Index)
+    // ==========================================
+    vector<NameMatch> searchByName(const string& query, int k) override {
+        return nameIndex.search(query, k > 0 ? (size_t)k : 0);
+    }
+
+    // ==========================================
+    // FEATURE: Batch Cancellation
+    // K skip list deletions, then one pass over the waitlist that drops
+    // cancelled IDs and promotes (queue order) into freed seats of the
+    // same class. Same promotion rule as ArraySystem::removePassengers.
+    // ==========================================
+    int removePassengers(const vector<string>& ids) override {
+        unordered_set<string> targets(ids.begin(), ids.end());
+        vector<pair<int, string>> freedSeats[CLASS_COUNT]; // (row, col) per class
+        int removed = 0;
+
+        // 1. Seated passengers
+        SkipNode* update[MAX_LEVEL];
+        for (const string& id : targets) {
+            SkipNode* node = findNode(id, update);
+            if (node == nullptr) continue;
+            int cls = classCode(node->rec.flightClass);
+            if (cls != CLASS_NONE) freedSeats[cls].push_back(make_pair(node->rec.seatRow, node->rec.seatCol));
+            eraseNode(node, update);
+            removed++;
+        }
+        int waitlistTargets = (int)targets.size() - removed;
+        int freedLeft = removed;
+
+        // 2. Waitlist: cancel + promote in one pass
+        int promoted = 0;
+        WaitlistNode* wPrev = nullptr;
+        WaitlistNode* wCurr = waitlistHead;
+        while (wCurr != nullptr && (waitlistTargets > 0 || freedLeft > 0)) {
+            WaitlistNode* wNext = wCurr->next;
+            bool unlink = false;
+
+            if (targets.count(wCurr->id)) {
+                nameIndex.remove(wCurr->id, true);
+                feed.publish(CHANGE_WAIT_LEAVE, wCurr->id, wCurr->name, wCurr->row, wCurr->col, wCurr->flightClass);
+                unlink = true;
+                waitlistTargets--;
+                removed++;
+            } else {
+                int cls = classCode(wCurr->flightClass);
+                if (cls != CLASS_NONE && !freedSeats[cls].empty()) {
+                    pair<int, string> seat = freedSeats[cls].back();
+                    freedSeats[cls].pop_back();
+                    freedLeft--;
+                    nameIndex.remove(wCurr->id, true);
+                    if (addPassenger(wCurr->id, wCurr->name, seat.first, seat.second, wCurr->flightClass)) {
+                        feed.publish(CHANGE_PROMOTE, wCurr->id, wCurr->name, seat.first, seat.second, wCurr->flightClass);
+                        promoted++;
+                        unlink = true;
+                    } else {
+                        nameIndex.add(wCurr->id, wCurr->name, true);
+                    }
+                }
+            }
+
+            if (unlink) {
+                if (wPrev == nullptr) waitlistHead = wNext;
+                else wPrev->next = wNext;
+                if (wCurr == waitlistTail) waitlistTail = wPrev;
+                waitTally.leave(wCurr->flightClass);
+                delete wCurr;
+            } else {
+                wPrev = wCurr;
+            }
+            wCurr = wNext;
+        }
+
+        cout << ">> [Batch] Cancelled " << removed << " of " << ids.size() << " IDs, "
+             << promoted << " promoted from Waitlist." << endl;
+        return removed;
+    }
+
+    // ==========================================
+    // FEATURE: Batch Lookup
+    // K skip list searches, the rest in one pass over the waitlist.
+    // ==========================================
+    vector<Passenger*> searchPassengers(const vector<string>& ids) override {
+        vector<Passenger*> result(ids.size(), nullptr);
+        unordered_map<string, vector<int>> pending; // ID -> positions in 'ids'
+
+        for (int i = 0; i < (int)ids.size(); i++) {
+            SkipNode* node = findNode(ids[i]);
+            if (node != nullptr) result[i] = &node->rec;
+            else pending[ids[i]].push_back(i);
+        }
+
+        batchWaitlistHits.clear();
+        batchWaitlistHits.reserve(pending.size()); // No reallocation: result pointers stay valid
+        for (WaitlistNode* w = waitlistHead; w != nullptr && !pending.empty(); w = w->next) {
+            auto found = pending.find(w->id);
+            if (found == pending.end()) continue;
+            batchWaitlistHits.push_back(waitlistRecord(w->id, w->name, w->flightClass));
+            for (int pos : found->second) result[pos] = &batchWaitlistHits.back();
+            pending.erase(found);
+        }
+        return result;
+    }
+
+    // ==========================================
+    // ALGORITHM 2: Sort By ID
+    // Nothing to sort: the skip list is kept in ID order on every insert.
+    // ==========================================
+    void sortByID() override {
+        cout << ">> [Skip List] Already in ID order (no sorting needed)." << endl;
+        displayManifest();
+    }
+};
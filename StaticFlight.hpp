@@ -0,0 +1,62 @@
+#ifndef STATICFLIGHT_HPP
+#define STATICFLIGHT_HPP
+
+#include <string>
+#include <type_traits>
+
+#include "FlightCommon.hpp"
+
+using namespace std;
+
+// ==========================================
+// STATIC DISPATCH FRONT END: StaticFlight<System>
+// Description: Thin template wrapper for hot loops (CSV loader, benchmark
+// harness, batch tools). Calls are bound at compile time with a qualified
+// call (sys.System::addPassenger), so there is no vtable lookup per record
+// and the compiler is free to inline the implementation.
+//
+// Usage:
+//   ArraySystem arr;
+//   StaticFlight<ArraySystem> fast(arr);
+//   fast.addPassenger(...);            // direct call, inlinable
+//
+// The interactive menu keeps using FlightSystem* (virtual) as before.
+// StaticFlight<FlightSystem> is also allowed and simply falls back to the
+// virtual call, so generic code can be written once for both paths.
+// ==========================================
+template <typename System>
+class StaticFlight {
+    static_assert(is_base_of<FlightSystem, System>::value, "StaticFlight needs a FlightSystem implementation");
+
+    // Abstract types (FlightSystem itself) cannot be called with a qualified name
+    static const bool isVirtual = is_abstract<System>::value;
+
+    System& sys;
+
+public:
+    explicit StaticFlight(System& system) : sys(system) {}
+
+    System& system() { return sys; }
+
+    inline bool addPassenger(const string& id, const string& name, int row, const string& col, const string& fclass) {
+        if constexpr (isVirtual) return sys.addPassenger(id, name, row, col, fclass);
+        else return sys.System::addPassenger(id, name, row, col, fclass);
+    }
+
+    inline bool removePassenger(const string& id) {
+        if constexpr (isVirtual) return sys.removePassenger(id);
+        else return sys.System::removePassenger(id);
+    }
+
+    inline Passenger* searchPassenger(const string& id) {
+        if constexpr (isVirtual) return sys.searchPassenger(id);
+        else return sys.System::searchPassenger(id);
+    }
+
+    inline void addToWaitlist(const string& id, const string& name, int row, const string& col, const string& fclass) {
+        if constexpr (isVirtual) sys.addToWaitlist(id, name, row, col, fclass);
+        else sys.System::addToWaitlist(id, name, row, col, fclass);
+    }
+};
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef TIMINGWHEEL_HPP
+#define TIMINGWHEEL_HPP
+
+#include <vector>
+
+using namespace std;
+
+// ==========================================
+// CLASS: TimingWheel
+// Description: Hierarchical timing wheel for many pending expiries
+// (seat holds). Time is an integer tick count chosen by the owner.
+// 1. 4 levels x 64 slots. Level L holds timers due 64^L .. 64^(L+1) ticks
+//    ahead; every 64^L ticks one level-L slot is cascaded into the lower
+//    levels. Timers further out than 64^4 ticks park in the top level and
+//    are re-filed each time their slot comes round.
+// 2. Each slot is an intrusive doubly linked list of pooled timers, so
+//    schedule and cancel are O(1) and a tick costs O(1) plus the timers
+//    that fire or move down - not a scan of everything pending.
+// advance() fires callback(payload) for every timer that is due.
+// ==========================================
+template <typename Payload>
+class TimingWheel {
+public:
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr int SLOTS = 1 << SLOT_BITS;
+
+private:
+    struct Timer {
+        Payload payload;
+        long long expires = 0;
+        int prev = -1;
+        int next = -1;
+        int level = -1;   // -1 = not in a slot (free or being fired)
+        int slot = 0;
+        bool active = false;
+    };
+
+    vector<Timer> timers;      // Pool; ids are indexes
+    vector<int> freeIds;
+    int heads[LEVELS][SLOTS];  // First timer of each slot list, -1 = empty
+    long long now = 0;
+    int pending = 0;
+
+    void link(int id) {
+        Timer& t = timers[id];
+        long long delta = t.expires - now;
+        int level = 0;
+        while (level < LEVELS - 1 && delta >= (1LL << (SLOT_BITS * (level + 1)))) level++;
+        int slot;
+        if (delta >= (1LL << (SLOT_BITS * LEVELS))) {
+            slot = (int)((now >> (SLOT_BITS * level)) & (SLOTS - 1)); // Park: re-filed a full top-level turn later
+        } else {
+            slot = (int)((t.expires >> (SLOT_BITS * level)) & (SLOTS - 1));
+        }
+        t.level = level;
+        t.slot = slot;
+        t.prev = -1;
+        t.next = heads[level][slot];
+        if (t.next != -1) timers[t.next].prev = id;
+        heads[level][slot] = id;
+    }
+
+    void unlink(int id) {
+        Timer& t = timers[id];
+        if (t.level < 0) return;
+        if (t.prev != -1) timers[t.prev].next = t.next;
+        else heads[t.level][t.slot] = t.next;
+        if (t.next != -1) timers[t.next].prev = t.prev;
+        t.level = -1;
+    }
+
+    // Detach a whole slot list (ids in list order)
+    vector<int> takeSlot(int level, int slot) {
+        vector<int> ids;
+        for (int id = heads[level][slot]; id != -1; id = timers[id].next) ids.push_back(id);
+        heads[level][slot] = -1;
+        for (int id : ids) timers[id].level = -1;
+        return ids;
+    }
+
+    void release(int id) {
+        timers[id].active = false;
+        timers[id].payload = Payload();
+        freeIds.push_back(id);
+        pending--;
+    }
+
+public:
+    TimingWheel() {
+        for (int l = 0; l < LEVELS; l++)
+            for (int s = 0; s < SLOTS; s++) heads[l][s] = -1;
+    }
+
+    long long currentTick() const { return now; }
+    int size() const { return pending; }
+
+    // Function: Run 'payload' at tick 'expires'; returns the timer id (for cancel)
+    int schedule(const Payload& payload, long long expires) {
+        int id;
+        if (!freeIds.empty()) {
+            id = freeIds.back();
+            freeIds.pop_back();
+        } else {
+            id = (int)timers.size();
+            timers.push_back(Timer());
+        }
+        timers[id].payload = payload;
+        timers[id].expires = expires > now ? expires : now + 1; // Already due: fires on the next tick
+        timers[id].active = true;
+        pending++;
+        link(id);
+        return id;
+    }
+
+    // Function: Drop a pending timer, O(1). False if it already fired.
+    bool cancel(int id) {
+        if (id < 0 || id >= (int)timers.size() || !timers[id].active) return false;
+        unlink(id);
+        release(id);
+        return true;
+    }
+
+    // Function: Move time forward to tick 'to', firing due timers in order.
+    // Returns how many fired. The callback may schedule or cancel timers.
+    template <typename Callback>
+    int advance(long long to, Callback callback) {
+        int fired = 0;
+        while (now < to) {
+            if (pending == 0) { // Nothing to cascade or fire
+                now = to;
+                break;
+            }
+            now++;
+
+            // Cascade: at each 64^L boundary, re-file the level-L slot now due
+            for (int level = 1; level < LEVELS; level++) {
+                if ((now & ((1LL << (SLOT_BITS * level)) - 1)) != 0) break;
+                int slot = (int)((now >> (SLOT_BITS * level)) & (SLOTS - 1));
+                for (int id : takeSlot(level, slot)) {
+                    if (timers[id].active && timers[id].level == -1) link(id);
+                }
+            }
+
+            for (int id : takeSlot(0, (int)(now & (SLOTS - 1)))) {
+                // Cancelled (and maybe reused) by an earlier callback
+                if (!timers[id].active || timers[id].level != -1) continue;
+                Payload payload = timers[id].payload;
+                release(id);
+                callback(payload);
+                fired++;
+            }
+        }
+        return fired;
+    }
+};
+
+#endif
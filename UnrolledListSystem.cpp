@@ -0,0 +1,708 @@
+#include "FlightCommon.hpp"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <unordered_set>
+#include <unordered_map>
+
+using namespace std;
+
+// ==========================================
+// NODE: RecordBlock (Unrolled Linked List Node)
+// Up to CAPACITY passengers stored back to back in one node.
+// The fields every scan needs (ID hash, packed seat) have their own small
+// arrays, so a scan reads 8 contiguous bytes per passenger and only opens
+// the full record when the hash matches.
+// ==========================================
+struct RecordBlock {
+    static constexpr int CAPACITY = 32;
+
+    int count = 0;
+    uint32_t idHash[CAPACITY];    // hash of passengerID (scan filter)
+    uint32_t seatKey[CAPACITY];   // (row << 5) | column index
+    Passenger recs[CAPACITY];     // Full records (next/prev unused here)
+
+    RecordBlock* next = nullptr;
+    RecordBlock* prev = nullptr;
+};
+
+// ==========================================
+// CLASS: UnrolledListSystem
+// Description: Implements the Flight System using an Unrolled Linked List.
+// Key Features:
+// 1. Doubly Linked List of blocks, each holding up to 32 passengers
+//    (one pointer chase per 32 records instead of per record).
+// 2. Insert appends to the tail block; delete shifts at most 31 records
+//    inside one block and merges half-empty neighbours (no global shifting).
+// 3. Singly Linked List for Waitlist (Requirement).
+// 4. Counting Bloom filter over seated + waitlisted IDs (skips most scans
+//    for unknown IDs).
+// Same behaviour as LinkedListSystem (no auto-fill on removal).
+// ==========================================
+class UnrolledListSystem final : public FlightSystem {
+private:
+    // --- Main List Variables (Doubly Linked List of Blocks) ---
+    RecordBlock* head;       // First block
+    RecordBlock* tail;       // Last block (appends go here)
+    int blockCount;          // Blocks in use
+    int currentCount;        // Total passengers
+    SeatOccupancy occupancy; // Bitmask view of taken seats (free-seat finder)
+    WaitlistTally waitTally; // Waitlist depth per class (stats)
+    ChangeFeed feed;         // Event stream of reservation changes
+    NameIndex nameIndex;     // Name search index (seated + waitlisted)
+    RowBucketIndex buckets;  // Per-row buckets of seated passengers (range queries)
+
+    // --- Waitlist Variables (Singly Linked List) ---
+    WaitlistNode* waitlistHead;
+    WaitlistNode* waitlistTail;
+
+    // --- ID Filter (Counting Bloom Filter, seated + waitlisted IDs) ---
+    CountingBloomFilter idBloom;
+    bool idFilterOn;
+
+    // ==========================================
+    // HELPER: ID Filter
+    // ==========================================
+    void filterAdd(const string& id) {
+        if (!idFilterOn) return;
+        idBloom.add(id);
+        if (idBloom.needsGrow()) rebuildIDFilter(idBloom.plannedIDs() * 2);
+    }
+    void filterRemove(const string& id) {
+        if (idFilterOn) idBloom.remove(id);
+    }
+    // false = ID certainly absent from the blocks and the waitlist
+    bool filterMayContain(const string& id) {
+        return !idFilterOn || idBloom.mayContain(id);
+    }
+    void rebuildIDFilter(size_t plannedIDs) {
+        idBloom.reset(plannedIDs);
+        for (RecordBlock* b = head; b != nullptr; b = b->next) {
+            for (int i = 0; i < b->count; i++) idBloom.add(b->recs[i].passengerID);
+        }
+        for (WaitlistNode* w = waitlistHead; w != nullptr; w = w->next) idBloom.add(w->id);
+    }
+
+    // ==========================================
+    // HELPER: Hot Fields
+    // ==========================================
+    static uint32_t hashID(const string& id) { return (uint32_t)hash<string>()(id); }
+    static uint32_t packSeat(int row, int cIndex) { return ((uint32_t)row << 5) | (uint32_t)cIndex; }
+
+    // Function: Write a record into slot i of a block (and its row bucket)
+    void storeRecord(RecordBlock* blk, int i, Passenger&& rec) {
+        int cIndex = FlightGlobal::getColIndex(rec.seatCol);
+        blk->idHash[i] = hashID(rec.passengerID);
+        blk->seatKey[i] = packSeat(rec.seatRow, cIndex);
+        blk->recs[i] = move(rec);
+        buckets.place(&blk->recs[i], blk->recs[i].seatRow, cIndex);
+    }
+
+    // Function: Move a record to another slot (buckets point at the new address)
+    void moveRecord(RecordBlock* from, int i, RecordBlock* to, int j) {
+        if (from == to && i == j) return;
+        to->idHash[j] = from->idHash[i];
+        to->seatKey[j] = from->seatKey[i];
+        to->recs[j] = move(from->recs[i]);
+        buckets.place(&to->recs[j], to->seatKey[j] >> 5, to->seatKey[j] & 31);
+    }
+
+    // Function: Find the block / slot holding an ID (hash filter, then string compare)
+    bool findRecord(const string& id, RecordBlock*& blk, int& index) {
+        uint32_t h = hashID(id);
+        for (RecordBlock* b = head; b != nullptr; b = b->next) {
+            for (int i = 0; i < b->count; i++) {
+                if (b->idHash[i] == h && b->recs[i].passengerID == id) {
+                    blk = b;
+                    index = i;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // ==========================================
+    // HELPER: Block Management
+    // ==========================================
+    RecordBlock* appendBlock() {
+        RecordBlock* blk = new RecordBlock;
+        blk->prev = tail;
+        if (tail != nullptr) tail->next = blk;
+        else head = blk;
+        tail = blk;
+        blockCount++;
+        return blk;
+    }
+
+    void unlinkBlock(RecordBlock* blk) {
+        if (blk->prev != nullptr) blk->prev->next = blk->next;
+        else head = blk->next;
+        if (blk->next != nullptr) blk->next->prev = blk->prev;
+        else tail = blk->prev;
+        delete blk;
+        blockCount--;
+    }
+
+    // Function: Remove slot 'index' of a block
+    // Shifts the rest of this block only, then frees an empty block or merges
+    // a less-than-half-full block with its neighbour when both fit in one.
+    void eraseRecord(RecordBlock* blk, int index) {
+        Passenger& rec = blk->recs[index];
+        int row = blk->seatKey[index] >> 5;
+        int cIndex = blk->seatKey[index] & 31;
+        occupancy.release(row, cIndex);
+        buckets.clear(row, cIndex);
+        nameIndex.remove(rec.passengerID, false);
+        filterRemove(rec.passengerID);
+        feed.publish(CHANGE_SEAT_REMOVE, rec.passengerID, rec.name, row, rec.seatCol, rec.flightClass);
+
+        for (int i = index; i < blk->count - 1; i++) moveRecord(blk, i + 1, blk, i);
+        blk->recs[--blk->count] = Passenger(); // Drop the strings of the vacated slot
+        currentCount--;
+
+        if (blk->count == 0) {
+            unlinkBlock(blk);
+            return;
+        }
+        RecordBlock* next = blk->next;
+        if (blk->count < RecordBlock::CAPACITY / 2 && next != nullptr && blk->count + next->count <= RecordBlock::CAPACITY) {
+            for (int i = 0; i < next->count; i++) moveRecord(next, i, blk, blk->count++);
+            unlinkBlock(next);
+        }
+    }
+
+    // Function: Free all blocks (records are rebuilt or destroyed by the caller)
+    void clearBlocks() {
+        RecordBlock* b = head;
+        while (b != nullptr) {
+            RecordBlock* nextBlock = b->next;
+            delete b;
+            b = nextBlock;
+        }
+        head = tail = nullptr;
+        blockCount = 0;
+    }
+
+    // ==========================================
+    // HELPER: Merge Sort Implementation (on a flat copy of the records)
+    // ==========================================
+    void mergeRecords(vector<Passenger>& a, vector<Passenger>& tmp, int left, int mid, int right) {
+        int i = left, j = mid + 1, k = left;
+        while (i <= mid && j <= right) {
+            if (a[i].passengerID <= a[j].passengerID) tmp[k++] = move(a[i++]);
+            else tmp[k++] = move(a[j++]);
+        }
+        while (i <= mid) tmp[k++] = move(a[i++]);
+        while (j <= right) tmp[k++] = move(a[j++]);
+        for (k = left; k <= right; k++) a[k] = move(tmp[k]);
+    }
+
+    void mergeSortRecords(vector<Passenger>& a, vector<Passenger>& tmp, int left, int right) {
+        if (left >= right) return;
+        int mid = left + (right - left) / 2;
+        mergeSortRecords(a, tmp, left, mid);
+        mergeSortRecords(a, tmp, mid + 1, right);
+        mergeRecords(a, tmp, left, mid, right);
+    }
+
+    // Function: Refill the blocks, full, from a flat record list
+    void rebuildFrom(vector<Passenger>& flat) {
+        clearBlocks();
+        for (Passenger& rec : flat) {
+            RecordBlock* blk = (tail == nullptr || tail->count == RecordBlock::CAPACITY) ? appendBlock() : tail;
+            storeRecord(blk, blk->count++, move(rec));
+        }
+    }
+
+    // --- Hooks for FlightSystem's shared seat features (auto-assign, group booking) ---
+    SeatOccupancy* seatOccupancy() override { return &occupancy; }
+
+    // Function: First group ID that already has a seat (one scan, skipped
+    // when the Bloom filter rules out every ID)
+    string findSeatedID(const unordered_set<string>& ids) override {
+        bool anyKnown = false;
+        for (const string& id : ids) anyKnown = filterMayContain(id) || anyKnown;
+        for (RecordBlock* b = anyKnown ? head : nullptr; b != nullptr; b = b->next) {
+            for (int i = 0; i < b->count; i++) {
+                if (ids.count(b->recs[i].passengerID)) return b->recs[i].passengerID;
+            }
+        }
+        return "";
+    }
+
+public:
+    // ==========================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ==========================================
+    UnrolledListSystem() {
+        head = nullptr;
+        tail = nullptr;
+        blockCount = 0;
+        currentCount = 0;
+        occupancy.reset(FlightGlobal::layout());
+        buckets.reset(FlightGlobal::layout());
+
+        waitlistHead = nullptr;
+        waitlistTail = nullptr;
+        idFilterOn = true;
+
+        cout << ">> Unrolled List System Initialized (" << RecordBlock::CAPACITY << " passengers per block)." << endl;
+    }
+
+    ~UnrolledListSystem() {
+        clearBlocks();
+
+        WaitlistNode* wTemp = waitlistHead;
+        while (wTemp != nullptr) {
+            WaitlistNode* wNext = wTemp->next;
+            delete wTemp;
+            wTemp = wNext;
+        }
+
+        cout << ">> Unrolled List System Destroyed (Memory Freed)." << endl;
+    }
+
+    // ==========================================
+    // FUNCTION 1: Reservation (Insertion)
+    // One scan over the hot arrays checks seat collision and duplicate ID,
+    // then the record is appended to the tail block.
+    // ==========================================
+    bool addPassenger(string id, string name, int row, string col, string fclass) override {
+        if (!validateSeatClass(row, fclass)) {
+            Log::error() << ">> [Error] Class Mismatch! " << fclass << " passengers cannot sit in Row " << row << ".";
+            int cls = classCode(fclass);
+            if (cls != CLASS_NONE) Log::warn() << ">> [Hint] " << fclass << " Class is " << FlightGlobal::layout().zoneText(cls) << ".";
+            else Log::warn() << ">> [Hint] Class must be First, Business or Economy.";
+            return false;
+        }
+
+        int cIndex = FlightGlobal::getColIndex(col);
+        if (cIndex == -1 || row < 1 || row > FlightGlobal::totalRows()) {
+            Log::error() << ">> [Error] Invalid Seat Position.";
+            return false;
+        }
+        if (FlightGlobal::layout().isBlocked(row, cIndex)) {
+            Log::error() << ">> [Error] Seat " << row << col << " is blocked on this aircraft.";
+            return false;
+        }
+
+        // 0. ID FILTER: a new ID needs no scan, the seat is checked in its row bucket
+        bool maybeKnown = !idFilterOn || idBloom.probe(id); // Not in the filter metrics: the waitlist is not walked here
+        if (!maybeKnown) {
+            Passenger* holder = buckets.at(row, cIndex);
+            if (holder != nullptr) {
+                Log::info() << ">> [System] Seat " << row << col << " is taken by " << holder->name
+                     << ". Adding " << name << " to Waitlist...";
+                addToWaitlist(id, name, row, col, fclass);
+                return false;
+            }
+        }
+
+        // 1. BLOCK SCAN (O(N), but 32 records per pointer chase)
+        uint32_t key = packSeat(row, cIndex);
+        uint32_t h = hashID(id);
+        bool duplicate = false;
+        for (RecordBlock* b = maybeKnown ? head : nullptr; b != nullptr; b = b->next) {
+            for (int i = 0; i < b->count; i++) {
+                // --- COLLISION CHECK ---
+                if (b->seatKey[i] == key) {
+                    Log::info() << ">> [System] Seat " << row << col << " is taken by " << b->recs[i].name
+                         << ". Adding " << name << " to Waitlist...";
+                    addToWaitlist(id, name, row, col, fclass);
+                    return false;
+                }
+                // --- DUPLICATE ID CHECK ---
+                // Keep scanning: a taken seat wins whatever the list order
+                if (b->idHash[i] == h && b->recs[i].passengerID == id) duplicate = true;
+            }
+        }
+        if (duplicate) {
+            Log::warn() << ">> [Failed] Passenger ID " << id << " already exists.";
+            return false;
+        }
+
+        // 2. Append to the tail block (new block when it is full)
+        Passenger rec;
+        rec.passengerID = id;
+        rec.name = name;
+        rec.seatRow = row;
+        rec.seatCol = FlightGlobal::getColName(cIndex);
+        rec.flightClass = fclass;
+
+        RecordBlock* blk = (tail == nullptr || tail->count == RecordBlock::CAPACITY) ? appendBlock() : tail;
+        storeRecord(blk, blk->count++, move(rec));
+        currentCount++;
+        occupancy.occupy(row, cIndex);
+        nameIndex.add(id, name, false);
+        filterAdd(id);
+        feed.publish(CHANGE_SEAT_ADD, id, name, row, FlightGlobal::getColName(cIndex), fclass);
+        return true;
+    }
+
+    // ==========================================
+    // FUNCTION 2: Cancellation (Deletion)
+    // ==========================================
+    bool removePassenger(string id) override {
+        RecordBlock* blk;
+        int index;
+        if (!filterMayContain(id) || !findRecord(id, blk, index)) return false;
+        eraseRecord(blk, index);
+        return true;
+    }
+
+    // ==========================================
+    // FUNCTION 3: Search (Main List, then Waitlist)
+    // ==========================================
+    Passenger* searchPassenger(const string& id) override {
+        if (!filterMayContain(id)) return nullptr; // Unknown ID: no scan
+
+        RecordBlock* blk;
+        int index;
+        if (findRecord(id, blk, index)) return &blk->recs[index];
+
+        for (WaitlistNode* wTemp = waitlistHead; wTemp != nullptr; wTemp = wTemp->next) {
+            if (wTemp->id == id) {
+                static Passenger tempResult; // Same "static object" trick as the other systems
+                tempResult = waitlistRecord(wTemp->id, wTemp->name, wTemp->flightClass);
+                return &tempResult;
+            }
+        }
+        if (idFilterOn) idBloom.noteFalsePositive(); // Filter said "maybe"
+        return nullptr;
+    }
+
+    // ==========================================
+    // FUNCTION 4: Display Map
+    // Each cell is read from the row buckets (O(1)), not searched for.
+    // ==========================================
+    void displaySeatingMap() override {
+        int maxRow = 20;
+        for (RecordBlock* b = head; b != nullptr; b = b->next) {
+            for (int i = 0; i < b->count; i++) {
+                int row = b->seatKey[i] >> 5;
+                if (row > maxRow) maxRow = row;
+            }
+        }
+        if (maxRow > FlightGlobal::totalRows()) maxRow = FlightGlobal::totalRows();
+
+        int totalPages = (maxRow + FlightGlobal::ROWS_PER_PAGE - 1) / FlightGlobal::ROWS_PER_PAGE;
+        if (totalPages < 1) totalPages = 1;
+        int currentPage = 1;
+
+        while (true) {
+            cout << string(50, '\n');
+            cout << "==========================================================================" << endl;
+            cout << "                   FLIGHT SEATING MAP (UNROLLED LIST)                     " << endl;
+            cout << "==========================================================================" << endl;
+            FlightGlobal::printSeatMapHeader();
+            cout << "--------------------------------------------------------------------------" << endl;
+
+            int startRow = (currentPage - 1) * FlightGlobal::ROWS_PER_PAGE;
+            int endRow = startRow + FlightGlobal::ROWS_PER_PAGE;
+            if (endRow > maxRow) endRow = maxRow;
+
+            for (int r = startRow; r < endRow; r++) {
+                int actualRow = r + 1;
+                cout << FlightGlobal::layout().rowLabel(actualRow) << setw(2) << setfill('0') << actualRow << setfill(' ') << " ";
+
+                for (int c = 0; c < FlightGlobal::cols(); c++) {
+                    Passenger* p = buckets.at(actualRow, c);
+                    string display = (p != nullptr) ? FlightGlobal::formatName(p->name) : "EMPTY";
+                    if (display.length() > 12) display = display.substr(0, 9) + "..";
+
+                    cout << "[" << left << setw(10) << display << "] ";
+                    if (FlightGlobal::layout().aisleAfter(c) && c < FlightGlobal::cols() - 1) cout << "    ";
+                }
+                cout << endl;
+            }
+
+            cout << "--------------------------------------------------------------------------" << endl;
+            cout << "PAGE " << currentPage << "/" << totalPages << " | [N]ext  [P]rev  [0] Exit: ";
+
+            string input;
+            cin >> input;
+
+            if (input == "0") break;
+            if ((input == "n" || input == "N") && currentPage < totalPages) currentPage++;
+            if ((input == "p" || input == "P") && currentPage > 1) currentPage--;
+        }
+    }
+
+    // ==========================================
+    // FUNCTION 5: Manifest
+    // ==========================================
+    void displayManifest() override {
+        if (head == nullptr) {
+            cout << ">> [Manifest] List is empty." << endl;
+        } else {
+            cout << "\n==============================================================" << endl;
+            cout << "             PASSENGER MANIFEST (UNROLLED LIST)" << endl;
+            cout << "==============================================================" << endl;
+            cout << left << setw(10) << "ID"
+                 << left << setw(20) << "Name"
+                 << left << setw(10) << "Seat"
+                 << left << setw(15) << "Class" << endl;
+            cout << "--------------------------------------------------------------" << endl;
+
+            for (RecordBlock* b = head; b != nullptr; b = b->next) {
+                for (int i = 0; i < b->count; i++) {
+                    const Passenger& p = b->recs[i];
+                    cout << left << setw(10) << p.passengerID
+                         << left << setw(20) << p.name
+                         << left << setw(10) << (to_string(p.seatRow) + p.seatCol)
+                         << left << setw(15) << p.flightClass << endl;
+                }
+            }
+            cout << "(" << currentCount << " passengers in " << blockCount << " blocks)" << endl;
+        }
+
+        cout << "\n------------------ WAITLIST (Singly Linked List) ------------------" << endl;
+        if (waitlistHead == nullptr) {
+            cout << "(Empty)" << endl;
+        } else {
+            int count = 1;
+            for (WaitlistNode* temp = waitlistHead; temp != nullptr; temp = temp->next) {
+                cout << count++ << ". " << temp->name << " (" << temp->id << ") - " << temp->flightClass << endl;
+            }
+        }
+
+        cout << "==============================================================" << endl;
+        cout << "Press Any Key + Enter to continue...";
+        string dummy; cin >> dummy;
+    }
+
+    // ==========================================
+    // ALGORITHM 1: Bubble Sort (By Name)
+    // Walks adjacent positions across block boundaries and swaps records.
+    // Row buckets are re-pointed once at the end.
+    // ==========================================
+    void sortAlphabetically() override {
+        if (currentCount < 2) {
+            cout << ">> Not enough passengers to sort." << endl;
+            return;
+        }
+        cout << ">> Sorting Unrolled List by Name (Bubble Sort)..." << endl;
+
+        for (int pass = 0; pass < currentCount - 1; pass++) {
+            bool swapped = false;
+            RecordBlock* b = head;
+            int i = 0;
+            for (int k = 0; k < currentCount - pass - 1; k++) {
+                RecordBlock* nb = b;
+                int ni = i + 1;
+                if (ni == nb->count) { nb = nb->next; ni = 0; } // Step into the next block
+
+                if (b->recs[i].name > nb->recs[ni].name) {
+                    swap(b->recs[i], nb->recs[ni]);
+                    swap(b->idHash[i], nb->idHash[ni]);
+                    swap(b->seatKey[i], nb->seatKey[ni]);
+                    swapped = true;
+                }
+                b = nb;
+                i = ni;
+            }
+            if (!swapped) break;
+        }
+
+        for (RecordBlock* b = head; b != nullptr; b = b->next) {
+            for (int i = 0; i < b->count; i++) buckets.place(&b->recs[i], b->seatKey[i] >> 5, b->seatKey[i] & 31);
+        }
+
+        cout << ">> Sort Complete." << endl;
+        displayManifest();
+    }
+
+    // ==========================================
+    // WAITLIST IMPLEMENTATION (Singly Linked List)
+    // ==========================================
+    void addToWaitlist(string id, string name, int row, string col, string fclass) override {
+        WaitlistNode* newNode = new WaitlistNode;
+        newNode->id = id;
+        newNode->name = name;
+        newNode->row = row;
+        newNode->col = col;
+        newNode->flightClass = fclass;
+        newNode->next = nullptr;
+        waitTally.join(fclass);
+        feed.publish(CHANGE_WAIT_JOIN, id, name, row, col, fclass);
+
+        if (waitlistHead == nullptr) {
+            waitlistHead = newNode;
+            waitlistTail = newNode;
+        } else {
+            waitlistTail->next = newNode;
+            waitlistTail = newNode;
+        }
+        nameIndex.add(id, name, true);
+        filterAdd(id);
+        Log::info() << ">> [Waitlist] " << name << " added for seat " << row << col << ".";
+    }
+
+    bool flightStats(FlightStats& stats) override {
+        fillSeatStats(stats, occupancy);
+        waitTally.fill(stats);
+        return true;
+    }
+
+    const ChangeFeed* changeFeed() const override { return &feed; }
+    void setChangeFeed(bool on) { feed.setEnabled(on); } // Benchmark switch
+
+    // Benchmark switch: ID filter on (default) / off
+    void setIDFilter(bool on) {
+        idFilterOn = on;
+        if (on) rebuildIDFilter(currentCount > 1024 ? currentCount * 2 : 1024);
+    }
+
+    const CountingBloomFilter* idFilter() const override { return idFilterOn ? &idBloom : nullptr; }
+
+    // ==========================================
+    // FEATURE: Range Queries (Row Buckets)
+    // ==========================================
+    vector<Passenger*> queryPassengers(int fromRow, int toRow, int cls, int col) override {
+        return buckets.query(fromRow, toRow, cls, col);
+    }
+
+    // ==========================================
+    // FEATURE: Name Search (Prefix / Fuzzy Index)
+    // ==========================================
+    vector<NameMatch> searchByName(const string& query, int k) override {
+        return nameIndex.search(query, k > 0 ? (size_t)k : 0);
+    }
+
+    // ==========================================
+    // FEATURE: Batch Cancellation
+    // One sweep over the blocks: survivors are packed forward (blocks end up
+    // full), cancelled records are dropped; then one pass over the waitlist.
+    // ==========================================
+    int removePassengers(const vector<string>& ids) override {
+        unordered_set<string> targets(ids.begin(), ids.end());
+        unordered_set<uint32_t> targetHashes;
+        for (const string& id : targets) targetHashes.insert(hashID(id));
+        int removed = 0;
+
+        // 1. Main list: stable filter with a write cursor
+        RecordBlock* wBlk = head;
+        int wIdx = 0;
+        for (RecordBlock* b = head; b != nullptr; b = b->next) {
+            for (int i = 0; i < b->count; i++) {
+                if (targetHashes.count(b->idHash[i]) && targets.count(b->recs[i].passengerID)) {
+                    int row = b->seatKey[i] >> 5;
+                    int cIndex = b->seatKey[i] & 31;
+                    occupancy.release(row, cIndex);
+                    buckets.clear(row, cIndex);
+                    nameIndex.remove(b->recs[i].passengerID, false);
+                    filterRemove(b->recs[i].passengerID);
+                    feed.publish(CHANGE_SEAT_REMOVE, b->recs[i].passengerID, b->recs[i].name, row, b->recs[i].seatCol, b->recs[i].flightClass);
+                    currentCount--;
+                    removed++;
+                    continue;
+                }
+                if (wIdx == RecordBlock::CAPACITY) { wBlk->count = wIdx; wBlk = wBlk->next; wIdx = 0; }
+                moveRecord(b, i, wBlk, wIdx++);
+            }
+        }
+        // Trim: the write cursor's block keeps wIdx records, later blocks are now empty
+        if (currentCount == 0) {
+            clearBlocks();
+        } else {
+            for (RecordBlock* b = wBlk->next; b != nullptr;) {
+                RecordBlock* nextBlock = b->next;
+                unlinkBlock(b);
+                b = nextBlock;
+            }
+            for (int i = wIdx; i < wBlk->count; i++) wBlk->recs[i] = Passenger();
+            wBlk->count = wIdx;
+        }
+
+        // 2. Waitlist
+        int left = (int)targets.size() - removed;
+        WaitlistNode* wPrev = nullptr;
+        WaitlistNode* wCurr = waitlistHead;
+        while (wCurr != nullptr && left > 0) {
+            WaitlistNode* wNext = wCurr->next;
+            if (targets.count(wCurr->id)) {
+                if (wPrev == nullptr) waitlistHead = wNext;
+                else wPrev->next = wNext;
+                if (wCurr == waitlistTail) waitlistTail = wPrev;
+                nameIndex.remove(wCurr->id, true);
+                filterRemove(wCurr->id);
+                waitTally.leave(wCurr->flightClass);
+                feed.publish(CHANGE_WAIT_LEAVE, wCurr->id, wCurr->name, wCurr->row, wCurr->col, wCurr->flightClass);
+                delete wCurr;
+                removed++;
+                left--;
+            } else {
+                wPrev = wCurr;
+            }
+            wCurr = wNext;
+        }
+
+        cout << ">> [Batch] Cancelled " << removed << " of " << ids.size() << " IDs." << endl;
+        return removed;
+    }
+
+    // ==========================================
+    // FEATURE: Batch Lookup
+    // One scan of the blocks (hash filter), then one pass over the waitlist.
+    // ==========================================
+    vector<Passenger*> searchPassengers(const vector<string>& ids) override {
+        vector<Passenger*> result(ids.size(), nullptr);
+        unordered_map<string, vector<int>> pending; // ID -> positions in 'ids'
+        unordered_set<uint32_t> pendingHashes;
+        for (int i = 0; i < (int)ids.size(); i++) {
+            if (!filterMayContain(ids[i])) continue; // Unknown ID: stays nullptr
+            pending[ids[i]].push_back(i);
+            pendingHashes.insert(hashID(ids[i]));
+        }
+
+        for (RecordBlock* b = head; b != nullptr && !pending.empty(); b = b->next) {
+            for (int i = 0; i < b->count; i++) {
+                if (!pendingHashes.count(b->idHash[i])) continue;
+                auto found = pending.find(b->recs[i].passengerID);
+                if (found == pending.end()) continue;
+                for (int pos : found->second) result[pos] = &b->recs[i];
+                pending.erase(found);
+            }
+        }
+
+        batchWaitlistHits.clear();
+        batchWaitlistHits.reserve(pending.size()); // No reallocation: result pointers stay valid
+        for (WaitlistNode* w = waitlistHead; w != nullptr && !pending.empty(); w = w->next) {
+            auto found = pending.find(w->id);
+            if (found == pending.end()) continue;
+            batchWaitlistHits.push_back(waitlistRecord(w->id, w->name, w->flightClass));
+            for (int pos : found->second) result[pos] = &batchWaitlistHits.back();
+            pending.erase(found);
+        }
+        return result;
+    }
+
+    // ==========================================
+    // ALGORITHM 2: Merge Sort (By ID)
+    // Records are moved into a flat array, merge sorted, and packed back
+    // into full blocks (also undoes fragmentation from deletions).
+    // ==========================================
+    void sortByID() override {
+        if (currentCount < 2) {
+            cout << ">> Not enough passengers to sort." << endl;
+            return;
+        }
+        cout << ">> [Unrolled List] Sorting by ID using MERGE SORT..." << endl;
+
+        vector<Passenger> flat;
+        flat.reserve(currentCount);
+        for (RecordBlock* b = head; b != nullptr; b = b->next) {
+            for (int i = 0; i < b->count; i++) flat.push_back(move(b->recs[i]));
+        }
+        vector<Passenger> tmp(flat.size());
+        mergeSortRecords(flat, tmp, 0, (int)flat.size() - 1);
+        rebuildFrom(flat);
+
+        cout << ">> Sort Complete (Merge Sort)." << endl;
+        displayManifest();
+    }
+};
@@ -0,0 +1,115 @@
+#ifndef WAITLISTHEAP_HPP
+#define WAITLISTHEAP_HPP
+
+#include <vector>
+#include <unordered_map>
+
+using namespace std;
+
+// Waitlist tiers: fare-paid waiters are promoted ahead of standby
+enum WaitPriority { WAIT_FARE_PAID = 0, WAIT_STANDBY = 1 };
+
+// ==========================================
+// CLASS: WaitlistHeap
+// Description: Indexed binary min-heap over waitlist entries for the
+// priority waitlist mode. Order: priority tier, then arrival sequence
+// (FIFO inside a tier). The systems keep one heap per fare class, since a
+// freed seat can only go to a waiter of its own class, and serve classes
+// First -> Business -> Economy when several seats free up at once.
+// Handle = whatever identifies the entry in the owner's storage (ring
+// sequence number, list node); a handle -> heap index map makes cancel
+// O(log N) like push and pop.
+// ==========================================
+template <typename Handle>
+class WaitlistHeap {
+public:
+    struct Key {
+        int priority;    // WaitPriority
+        long long seq;   // Arrival order
+    };
+
+private:
+    struct Item {
+        Key key;
+        Handle handle;
+    };
+    vector<Item> heap;
+    unordered_map<Handle, int> where; // handle -> index in heap
+
+    static bool before(const Key& a, const Key& b) {
+        if (a.priority != b.priority) return a.priority < b.priority;
+        return a.seq < b.seq;
+    }
+
+    void place(int i, Item&& item) {
+        where[item.handle] = i;
+        heap[i] = std::move(item);
+    }
+
+    void siftUp(int i) {
+        Item item = std::move(heap[i]);
+        while (i > 0) {
+            int parent = (i - 1) / 2;
+            if (!before(item.key, heap[parent].key)) break;
+            place(i, std::move(heap[parent]));
+            i = parent;
+        }
+        place(i, std::move(item));
+    }
+
+    void siftDown(int i) {
+        int n = (int)heap.size();
+        Item item = std::move(heap[i]);
+        while (true) {
+            int child = 2 * i + 1;
+            if (child >= n) break;
+            if (child + 1 < n && before(heap[child + 1].key, heap[child].key)) child++;
+            if (!before(heap[child].key, item.key)) break;
+            place(i, std::move(heap[child]));
+            i = child;
+        }
+        place(i, std::move(item));
+    }
+
+public:
+    int size() const { return (int)heap.size(); }
+    bool empty() const { return heap.empty(); }
+    bool contains(const Handle& h) const { return where.count(h) > 0; }
+
+    void push(const Handle& h, int priority, long long seq) {
+        heap.push_back(Item{ Key{ priority, seq }, h });
+        siftUp((int)heap.size() - 1);
+    }
+
+    // Best waiter (heap must not be empty)
+    const Handle& top() const { return heap[0].handle; }
+    const Key& topKey() const { return heap[0].key; }
+
+    void pop() { erase(heap[0].handle); }
+
+    // Function: Remove any entry by handle, O(log N)
+    bool erase(const Handle& h) {
+        auto found = where.find(h);
+        if (found == where.end()) return false;
+        int i = found->second;
+        where.erase(found);
+        int last = (int)heap.size() - 1;
+        if (i != last) {
+            heap[i] = std::move(heap[last]);
+            heap.pop_back();
+            where[heap[i].handle] = i;
+            if (i > 0 && before(heap[i].key, heap[(i - 1) / 2].key)) siftUp(i);
+            else siftDown(i);
+        } else {
+            heap.pop_back();
+        }
+        return true;
+    }
+
+    void clear() {
+        heap.clear();
+        where.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef WAITLISTRING_HPP
+#define WAITLISTRING_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+
+using namespace std;
+
+// One waiting passenger; 'seq' is the arrival number (tombstone: live = false)
+struct WaitlistEntry {
+    long long seq = 0;
+    string id;
+    string name;
+    int row = 0;      // Seat they asked for
+    string col;
+    string flightClass;
+    int priority = 0; // WaitPriority (priority waitlist mode)
+    bool live = false;
+};
+
+// ==========================================
+// CLASS: WaitlistRing
+// Description: FIFO waitlist stored in one contiguous, growable ring.
+// 1. Entry with sequence number s lives in slot s & (capacity - 1); the
+//    queue is [headSeq, tailSeq). Growing doubles the ring.
+// 2. ID -> sequence map: find / cancel by ID in O(1). A cancelled entry
+//    becomes a tombstone until the head moves past it.
+// 3. Tombstones are counted per slot in a Fenwick tree, so the queue
+//    position of an entry is (seq - headSeq) minus the tombstones in front
+//    of it: O(1) while there are none, O(log W) otherwise.
+// Sequence numbers are stable except across compact(), which the owner
+// calls at points where it holds no sequence numbers.
+// ==========================================
+class WaitlistRing {
+private:
+    vector<WaitlistEntry> ring;   // size = capacity (power of two)
+    vector<int> dead;             // Fenwick tree over slots: tombstones (1-based)
+    long long headSeq = 0;        // Oldest entry still in the ring (live or tombstone)
+    long long tailSeq = 0;        // Next sequence number to hand out
+    int liveCount = 0;
+    int deadCount = 0;
+    unordered_multimap<string, long long> seqByID; // An ID can be waitlisted twice
+
+    size_t mask() const { return ring.size() - 1; }
+
+    void fenwickAdd(size_t slot, int delta) {
+        for (size_t i = slot + 1; i <= dead.size(); i += i & (0 - i)) dead[i - 1] += delta;
+    }
+    int fenwickPrefix(size_t slots) const { // Tombstones in slots [0, slots)
+        int sum = 0;
+        for (size_t i = slots; i > 0; i -= i & (0 - i)) sum += dead[i - 1];
+        return sum;
+    }
+    // Tombstones with sequence numbers in [headSeq, seq)
+    int deadBefore(long long seq) const {
+        if (deadCount == 0 || seq == headSeq) return 0;
+        size_t from = headSeq & mask();
+        size_t to = seq & mask();
+        if (from < to) return fenwickPrefix(to) - fenwickPrefix(from);
+        return fenwickPrefix(ring.size()) - fenwickPrefix(from) + fenwickPrefix(to);
+    }
+
+    void unmapID(const string& id, long long seq) {
+        auto range = seqByID.equal_range(id);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == seq) {
+                seqByID.erase(it);
+                return;
+            }
+        }
+    }
+
+    // Function: Drop tombstones at the head so headSeq is live (or the queue is empty)
+    void trimHead() {
+        while (headSeq < tailSeq && !ring[headSeq & mask()].live) {
+            size_t slot = headSeq & mask();
+            fenwickAdd(slot, -1);
+            deadCount--;
+            ring[slot] = WaitlistEntry();
+            headSeq++;
+        }
+    }
+
+    // Function: Move every entry into a ring of 'capacity' slots.
+    // dropDead = also remove tombstones and renumber the live entries.
+    void rebuild(size_t capacity, bool dropDead) {
+        vector<WaitlistEntry> old;
+        old.swap(ring);
+        size_t oldMask = old.size() - 1;
+        ring.assign(capacity, WaitlistEntry());
+        dead.assign(capacity, 0);
+
+        long long next = headSeq;
+        for (long long s = headSeq; s < tailSeq; s++) {
+            WaitlistEntry& e = old[s & oldMask];
+            if (dropDead && !e.live) continue;
+            if (dropDead && e.seq != next) {
+                unmapID(e.id, e.seq);
+                seqByID.emplace(e.id, next);
+                e.seq = next;
+            }
+            long long at = dropDead ? next : s;
+            if (!e.live) fenwickAdd(at & (capacity - 1), 1);
+            ring[at & (capacity - 1)] = std::move(e);
+            next++;
+        }
+        if (dropDead) {
+            tailSeq = next;
+            deadCount = 0;
+        }
+    }
+
+public:
+    explicit WaitlistRing(size_t capacity = 16) {
+        size_t c = 1;
+        while (c < capacity) c <<= 1;
+        ring.assign(c, WaitlistEntry());
+        dead.assign(c, 0);
+    }
+
+    int size() const { return liveCount; }
+    bool empty() const { return liveCount == 0; }
+    size_t capacity() const { return ring.size(); }
+    int tombstones() const { return deadCount; }
+
+    // Function: Append to the back of the queue, returns the sequence number
+    long long push(const string& id, const string& name, int row, const string& col, const string& fclass, int priority = 0) {
+        if (tailSeq - headSeq == (long long)ring.size()) rebuild(ring.size() * 2, false);
+        WaitlistEntry& e = ring[tailSeq & mask()];
+        e.seq = tailSeq;
+        e.id = id;
+        e.name = name;
+        e.row = row;
+        e.col = col;
+        e.flightClass = fclass;
+        e.priority = priority;
+        e.live = true;
+        seqByID.emplace(id, tailSeq);
+        liveCount++;
+        return tailSeq++;
+    }
+
+    // --- Queue Order ---
+    // Live entries are at(s) != nullptr for s in [firstSeq(), endSeq()).
+    // Pointers are valid until the next push / remove.
+    long long firstSeq() const { return headSeq; }
+    long long endSeq() const { return tailSeq; }
+
+    WaitlistEntry* at(long long seq) {
+        if (seq < headSeq || seq >= tailSeq) return nullptr;
+        WaitlistEntry& e = ring[seq & mask()];
+        return e.live ? &e : nullptr;
+    }
+
+    WaitlistEntry* front() { return liveCount > 0 ? &ring[headSeq & mask()] : nullptr; }
+
+    // Function: Remove the entry with this sequence number (O(1) + Fenwick update)
+    bool removeAt(long long seq) {
+        WaitlistEntry* e = at(seq);
+        if (e == nullptr) return false;
+        unmapID(e->id, seq);
+        liveCount--;
+        if (seq == headSeq) {
+            *e = WaitlistEntry();
+            headSeq++;
+            trimHead();
+        } else {
+            e->live = false;
+            e->id.clear(); e->name.clear(); e->col.clear(); e->flightClass.clear();
+            fenwickAdd(seq & mask(), 1);
+            deadCount++;
+        }
+        return true;
+    }
+
+    void popFront() { if (liveCount > 0) removeAt(headSeq); }
+
+    // --- By ID ---
+
+    // First (oldest) entry with this ID, or nullptr
+    WaitlistEntry* find(const string& id) {
+        auto range = seqByID.equal_range(id);
+        long long best = -1;
+        for (auto it = range.first; it != range.second; ++it) {
+            if (best == -1 || it->second < best) best = it->second;
+        }
+        return best == -1 ? nullptr : at(best);
+    }
+
+    bool contains(const string& id) const { return seqByID.count(id) > 0; }
+
+    // Function: 1-based place in the queue of the first entry with this ID (0 = not waiting)
+    int position(const string& id) {
+        WaitlistEntry* e = find(id);
+        if (e == nullptr) return 0;
+        return (int)(e->seq - headSeq) - deadBefore(e->seq) + 1;
+    }
+
+    // Function: Cancel the first entry with this ID
+    bool cancel(const string& id) {
+        WaitlistEntry* e = find(id);
+        return e != nullptr && removeAt(e->seq);
+    }
+
+    // Function: Remove tombstones once they outnumber the live entries
+    // (renumbers the sequence numbers; shrinks the ring when mostly empty).
+    // Returns true if it ran.
+    bool compact() {
+        if (deadCount < 64 || deadCount <= liveCount) return false;
+        size_t c = ring.size();
+        while (c > 16 && (size_t)liveCount * 4 < c) c >>= 1;
+        rebuild(c, true);
+        return true;
+    }
+
+    void clear() {
+        size_t c = ring.size();
+        ring.assign(c, WaitlistEntry());
+        dead.assign(c, 0);
+        seqByID.clear();
+        headSeq = tailSeq = 0;
+        liveCount = deadCount = 0;
+    }
+};
+
+#endif
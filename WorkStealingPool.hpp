@@ -0,0 +1,141 @@
+#ifndef WORKSTEALINGPOOL_HPP
+#define WORKSTEALINGPOOL_HPP
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+using namespace std;
+
+// ==========================================
+// CLASS: WorkStealingPool
+// Description: Fixed pool of worker threads for many independent tasks of
+// uneven cost (ScanPool splits one scan into equal parts instead).
+// 1. run(n, job) deals tasks 0..n-1 out in contiguous blocks, one task
+//    queue per thread; the calling thread is worker 0.
+// 2. A worker takes tasks from the front of its own queue. When it runs
+//    dry it steals from the back of another worker's queue, so threads
+//    that drew cheap tasks help the ones that drew expensive ones.
+// 3. Each queue has its own small lock, held only to take one task.
+// job(task, worker) gets the worker number, so callers can keep one
+// scratch object per worker without any sharing.
+// ==========================================
+class WorkStealingPool {
+private:
+    struct TaskQueue {
+        mutex lock;
+        deque<int> tasks;
+    };
+
+    vector<thread> workers;
+    vector<unique_ptr<TaskQueue>> queues; // [worker]
+    mutex lock;
+    condition_variable wake;
+    condition_variable finished;
+    const function<void(int, int)>* job = nullptr; // Valid while run() waits
+    int pending = 0;           // Workers still busy with the current run
+    unsigned generation = 0;   // Bumped per run so each worker joins once
+    bool stopping = false;
+    int threadCount;
+    atomic<long long> stealCount{0};
+
+    bool takeTask(int self, int& task) {
+        {
+            TaskQueue& own = *queues[self];
+            lock_guard<mutex> guard(own.lock);
+            if (!own.tasks.empty()) {
+                task = own.tasks.front();
+                own.tasks.pop_front();
+                return true;
+            }
+        }
+        for (int k = 1; k < threadCount; k++) {
+            TaskQueue& victim = *queues[(self + k) % threadCount];
+            lock_guard<mutex> guard(victim.lock);
+            if (!victim.tasks.empty()) {
+                task = victim.tasks.back();
+                victim.tasks.pop_back();
+                stealCount.fetch_add(1, memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void drain(int self) {
+        int task;
+        while (takeTask(self, task)) (*job)(task, self);
+    }
+
+    void workerLoop(int self) {
+        unsigned seen = 0;
+        while (true) {
+            {
+                unique_lock<mutex> guard(lock);
+                wake.wait(guard, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+            drain(self);
+            {
+                lock_guard<mutex> guard(lock);
+                if (--pending == 0) finished.notify_one();
+            }
+        }
+    }
+
+public:
+    explicit WorkStealingPool(int threads) : threadCount(threads < 1 ? 1 : threads) {
+        for (int i = 0; i < threadCount; i++) queues.emplace_back(new TaskQueue());
+    }
+
+    ~WorkStealingPool() {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (thread& t : workers) t.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    int size() const { return threadCount; }
+    long long steals() const { return stealCount.load(); }
+
+    // Function: Run f(task, worker) for every task in [0, n), return when all are done
+    void run(int n, const function<void(int, int)>& f) {
+        if (n <= 0) return;
+        for (int w = 0; w < threadCount; w++) {
+            long long begin = (long long)n * w / threadCount;
+            long long end = (long long)n * (w + 1) / threadCount;
+            lock_guard<mutex> guard(queues[w]->lock);
+            for (long long t = begin; t < end; t++) queues[w]->tasks.push_back((int)t);
+        }
+        job = &f;
+        if (threadCount == 1) {
+            drain(0);
+            return;
+        }
+        if (workers.empty()) {
+            for (int w = 1; w < threadCount; w++) workers.emplace_back(&WorkStealingPool::workerLoop, this, w);
+        }
+        {
+            lock_guard<mutex> guard(lock);
+            pending = threadCount - 1;
+            generation++;
+        }
+        wake.notify_all();
+        drain(0);
+        unique_lock<mutex> guard(lock);
+        finished.wait(guard, [&] { return pending == 0; });
+    }
+};
+
+#endif
@@ -1,21 +1,27 @@
 #include <iostream>
 #include <string>
+#include <vector>
 #include <limits> 
 #include <fstream>
 #include <sstream>
 #include <cctype>   
+#include <mutex>
 
 #include "FlightCommon.hpp"
 #include "Timer.hpp" // Custom Timer Class for Performance Testing
+#include "DataLoader.hpp" // CSV Loader (static dispatch for bulk ingest)
+#include "CsvFollower.hpp" // Follow mode: rows appended to the CSV while running
+#include "CommandServer.hpp" // Server mode: line protocol over stdin or a Unix socket
+#include <csignal>
 
 // Include System Implementations
 #include "ArraySystem.cpp"
 #include "LinkedListSystem.cpp" 
+#include "UnrolledListSystem.cpp"
+#include "SkipListSystem.cpp"
 
 using namespace std;
 
-long long globalMaxID = 0;
-
 // ==========================================
 // HELPER FUNCTIONS (Input Validation)
 // ==========================================
@@ -30,32 +36,30 @@ string toLowerStr(string s) {
     return s;
 }
 
-// Function: Safe Integer Input for Row (1-100)
+// Function: Safe Integer Input for Row (1 - last row of the aircraft)
 int readRow() {
-int row;
+    int row;
+    int maxRow = FlightGlobal::totalRows();
     while (true) {
-        cout << "Enter Row (1-30): "; // <--- Change prompt text
+        cout << "Enter Row (1-" << maxRow << "): ";
         
-        // <--- Change 100 to 30 below
-        if (cin >> row && row >= 1 && row <= 30) return row; 
+        if (cin >> row && row >= 1 && row <= maxRow) return row; 
         
-        cout << ">> [Error] Please enter a valid row number (1-30).\n";
+        cout << ">> [Error] Please enter a valid row number (1-" << maxRow << ").\n";
         cin.clear();
         cin.ignore(numeric_limits<streamsize>::max(), '\n');
     }
 }
 
-// Function: Safe Column Input (A-F)
-string readCol_AtoF() {
+// Function: Safe Column Input (columns of the aircraft, e.g. A-F)
+string readCol() {
     string col;
     while (true) {
-        cout << "Enter Col (A-F): ";
+        cout << "Enter Col (" << FlightGlobal::colRangeText() << "): ";
         cin >> col;
-        if (!col.empty()) {
-            char c = (char)toupper((unsigned char)col[0]);
-            if (c >= 'A' && c <= 'F') return string(1, c);
-        }
-        cout << ">> [Error] Column must be A, B, C, D, E, or F.\n";
+        int index = FlightGlobal::getColIndex(col);
+        if (index != -1 && col.size() == 1) return FlightGlobal::getColName(index);
+        cout << ">> [Error] Column must be between " << FlightGlobal::colRangeText() << ".\n";
     }
 }
 
@@ -73,47 +77,32 @@ string readClass_FBE() {
     }
 }
 
-// ==========================================
-// FILE I/O: CSV Loader
-// ==========================================
-void loadData(FlightSystem* sys, string filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
-        cout << "Error: Could not open file " << filename << endl;
-        return;
+// Function: Seat Preference Input (Any / Window / Aisle)
+int readSeatPreference() {
+    string pref;
+    while (true) {
+        cout << "Seat Preference (Any/Window/Aisle): ";
+        cin >> pref;
+        string x = toLowerStr(pref);
+        if (x == "any" || x == "a" || x == "0") return SEAT_ANY;
+        if (x.find("win") == 0 || x == "w") return SEAT_WINDOW;
+        if (x.find("ais") == 0) return SEAT_AISLE;
+        cout << ">> [Error] Preference must be Any, Window or Aisle.\n";
     }
-    string line;
-    getline(file, line); // Skip Header
-
-    int count = 0;
-    while (getline(file, line)) {
-        stringstream ss(line);
-        string id, name, rowStr, col, fclass;
-        
-        getline(ss, id, ',');
-        getline(ss, name, ',');
-        getline(ss, rowStr, ',');
-        getline(ss, col, ',');
-        getline(ss, fclass, ',');
-
-        if (!col.empty() && col.back() == '\r') col.pop_back();
-        if (!fclass.empty() && fclass.back() == '\r') fclass.pop_back();
-
-        if (!id.empty() && !rowStr.empty()) {
-            try {
-                // [NEW] Track the highest ID
-                long long currentIdVal = stoll(id); // Convert string ID to number
-                if (currentIdVal > globalMaxID) {
-                    globalMaxID = currentIdVal;
-                }
+}
 
-                sys->addPassenger(id, name, stoi(rowStr), col, fclass);
-                count++;
-            } catch (...) {}
-        }
-    }
-    cout << ">> Loaded " << count << " passengers into " << filename << endl;
-    file.close();
+// Function: Read a list of IDs on one line (separated by spaces or commas)
+vector<string> readIDList() {
+    string line, id;
+    cout << "Enter Passenger IDs (space or comma separated): ";
+    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    getline(cin, line);
+    for (char& ch : line) if (ch == ',') ch = ' ';
+
+    vector<string> ids;
+    stringstream ss(line);
+    while (ss >> id) ids.push_back(id);
+    return ids;
 }
 
 // ==========================================
@@ -127,16 +116,52 @@ void showSubMenu(string systemName) {
     cout << "4. Display Seat Map (Visual Rendering Time)" << endl;
     cout << "5. Display Manifest (Bubble Sort by Name)" << endl;
     cout << "6. Display Manifest (Merge Sort by ID)" << endl;
+    cout << "7. Add Passenger (Auto-Assign Best Available Seat)" << endl;
+    cout << "8. Free Seats per Class" << endl;
+    cout << "9. Group Booking (K Adjacent Seats)" << endl;
+    cout << "10. Search by Name (Prefix / Fuzzy)" << endl;
+    cout << "11. Boarding Query (Rows / Class / Column)" << endl;
+    cout << "12. Batch Cancel (List of IDs)" << endl;
+    cout << "13. Batch Search (List of IDs)" << endl;
+    cout << "14. ID Filter Metrics (Bloom Filter)" << endl;
+    cout << "15. Leave Waitlist (Cancel by ID)" << endl;
+    cout << "16. Priority Waitlist On/Off (Class, Fare-paid, Arrival)" << endl;
+    cout << "17. Seat Hold (Hold / Confirm / Release)" << endl;
+    cout << "18. Flight Statistics (Live Counters)" << endl;
     cout << "0. Back to Main Menu" << endl;
     cout << "Select Operation: ";
 }
 
+// ==========================================
+// FOLLOW MODE (--follow)
+// A background thread watches the CSV for appended rows and books them
+// into every system as soon as they are read. The systems are
+// single-threaded, so they are guarded by systemsLock: the follow thread
+// holds it while booking, a menu command or a server batch while it runs.
+// The menu does not hold it while it waits for input, so rows become
+// bookable while the menu sits idle (latency: bench follow).
+// ==========================================
+mutex systemsLock;
+vector<FlightSystem*> followSystems;
+
+void bookFollowedRows(const vector<string>& lines, CsvFollowThread::Clock::time_point /*seenAt*/) {
+    lock_guard<mutex> guard(systemsLock);
+    int booked = 0;
+    for (FlightSystem* sys : followSystems) booked = ingestLines(sys, lines);
+    Log::info() << ">> [Follow] " << booked << " new row(s) booked into every system.";
+}
+
 void runSystem(FlightSystem* sys, string name) {
     int choice;
     string id, pname, seatCol, fclass;
     int row;
 
     do {
+        {
+            lock_guard<mutex> guard(systemsLock);
+            int expired = sys->expireHolds(); // Holds that ran out while the menu was idle
+            if (expired > 0) cout << ">> [Hold] " << expired << " seat hold(s) expired." << endl;
+        }
         showSubMenu(name);
         if (!(cin >> choice)) {
             cin.clear();
@@ -144,6 +169,8 @@ void runSystem(FlightSystem* sys, string name) {
             choice = -1;
         }
 
+        // The command has the systems to itself (follow mode books rows in between)
+        lock_guard<mutex> guard(systemsLock);
         switch (choice) {
             // --- OPERATION 1: ADD PASSENGER ---
             case 1: { 
@@ -157,7 +184,7 @@ void runSystem(FlightSystem* sys, string name) {
                 cin.ignore();
                 getline(cin, pname);
                 row = readRow();
-                seatCol = readCol_AtoF();
+                seatCol = readCol();
                 fclass = readClass_FBE();
 
                 // 3. Start Timer
@@ -175,10 +202,12 @@ void runSystem(FlightSystem* sys, string name) {
                 // 5. Handle Waitlist (Singly Linked List) if Full
                 if (!success) {
                     char choice;
-                    cout << ">> Seat/ID invalid or taken. Add to Waitlist? (y/n): ";
+                    cout << ">> Seat/ID invalid or taken. Add to Waitlist? (y/n, s = standby): ";
                     cin >> choice;
                     if (choice == 'y' || choice == 'Y') {
                         sys->addToWaitlist(id, pname, row, seatCol, fclass);
+                    } else if (choice == 's' || choice == 'S') {
+                        sys->addStandby(id, pname, row, seatCol, fclass);
                     }
                 }
                 break;
@@ -214,6 +243,9 @@ void runSystem(FlightSystem* sys, string name) {
                     if (p) cout << ">> Found: " << p->name << endl;
                     else cout << ">> Not found.\n";
 
+                    int position = (p && p->seatRow == 0) ? sys->waitlistPosition(id) : -1;
+                    if (position > 0) cout << ">> Waitlist position: " << position << endl;
+
                     cout << ">> [Performance] Search Time: " << t.getDurationInMicroseconds() << " microseconds" << endl;
                 }
                 break;
@@ -261,6 +293,292 @@ void runSystem(FlightSystem* sys, string name) {
                 }
                 break;
 
+            // --- OPERATION 7: AUTO-ASSIGN BOOKING ---
+            case 7: {
+                globalMaxID++;
+                id = to_string(globalMaxID);
+                cout << ">> Auto-Generated ID: " << id << endl;
+
+                cout << "Enter Name: ";
+                cin.ignore();
+                getline(cin, pname);
+                fclass = readClass_FBE();
+                int pref = readSeatPreference();
+
+                Timer t;
+                t.start();
+                bool success = sys->autoAssignPassenger(id, pname, fclass, pref);
+                t.stop();
+                cout << ">> [Performance] Auto-Assign Time: " << t.getDurationInMicroseconds() << " microseconds" << endl;
+
+                if (!success) {
+                    char choice;
+                    cout << ">> No seat assigned. Add to Waitlist? (y/n, s = standby): ";
+                    cin >> choice;
+                    if (choice == 'y' || choice == 'Y') {
+                        sys->addToWaitlist(id, pname, 0, "ANY", fclass);
+                    } else if (choice == 's' || choice == 'S') {
+                        sys->addStandby(id, pname, 0, "ANY", fclass);
+                    }
+                }
+                break;
+            }
+
+            // --- OPERATION 8: FREE SEATS PER CLASS ---
+            case 8: {
+                cout << "\n--- Free Seats (" << FlightGlobal::layout().name << ") ---" << endl;
+                for (int c = 0; c < CLASS_COUNT; c++) {
+                    int freeSeats = sys->countFreeSeats(c);
+                    cout << left << setw(10) << className(c) << " (" << FlightGlobal::layout().zoneText(c) << "): ";
+                    if (freeSeats < 0) cout << "n/a" << endl;
+                    else cout << freeSeats << " free" << endl;
+                }
+                break;
+            }
+
+            // --- OPERATION 9: GROUP BOOKING ---
+            case 9: {
+                int groupSize;
+                cout << "Group Size: ";
+                if (!(cin >> groupSize) || groupSize < 1 || groupSize > 50) {
+                    cout << ">> [Error] Group size must be 1-50.\n";
+                    cin.clear();
+                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                    break;
+                }
+                fclass = readClass_FBE();
+                cin.ignore();
+
+                vector<string> ids, names;
+                for (int i = 0; i < groupSize; i++) {
+                    cout << "Name of member " << (i + 1) << ": ";
+                    getline(cin, pname);
+                    ids.push_back(to_string(globalMaxID + 1 + i));
+                    names.push_back(pname);
+                }
+
+                Timer t;
+                t.start();
+                bool success = sys->addGroup(ids, names, fclass);
+                t.stop();
+                if (success) globalMaxID += groupSize; // IDs are only consumed if the group was booked
+                cout << ">> [Performance] Group Booking Time: " << t.getDurationInMicroseconds() << " microseconds" << endl;
+                break;
+            }
+
+            // --- OPERATION 10: NAME SEARCH ---
+            case 10: {
+                cout << "Enter full, partial or misspelled name: ";
+                cin.ignore();
+                getline(cin, pname);
+
+                Timer t;
+                t.start();
+                vector<NameMatch> matches = sys->searchByName(pname, 10);
+                t.stop();
+
+                if (matches.empty()) cout << ">> No matching names.\n";
+                for (size_t i = 0; i < matches.size(); i++) {
+                    cout << (i + 1) << ". " << left << setw(20) << matches[i].name
+                         << " (" << matches[i].id << ") "
+                         << (matches[i].waitlisted ? "[WAITLIST]" : "[SEATED]")
+                         << "  score " << fixed << setprecision(2) << matches[i].score << endl;
+                }
+                cout.unsetf(ios::fixed);
+                cout << ">> [Performance] Name Search Time: " << t.getDurationInMicroseconds() << " microseconds" << endl;
+                break;
+            }
+
+            // --- OPERATION 11: BOARDING QUERY (ROW BUCKETS) ---
+            case 11: {
+                int fromRow, toRow;
+                string classFilter, colFilter;
+                cout << "From Row: ";
+                cin >> fromRow;
+                cout << "To Row: ";
+                cin >> toRow;
+                if (!cin || fromRow > toRow) {
+                    cout << ">> [Error] Enter a valid row range.\n";
+                    cin.clear();
+                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                    break;
+                }
+                cout << "Class (First/Business/Economy/All): ";
+                cin >> classFilter;
+                cout << "Col (" << FlightGlobal::colRangeText() << ", * = All): ";
+                cin >> colFilter;
+
+                string x = toLowerStr(classFilter);
+                int cls = -1;
+                if (x == "all") cls = CLASS_NONE;
+                else if (x == "first") cls = CLASS_FIRST;
+                else if (x.find("bus") == 0) cls = CLASS_BUSINESS;
+                else if (x.find("eco") == 0) cls = CLASS_ECONOMY;
+                int col = (colFilter == "*") ? -1 : FlightGlobal::getColIndex(colFilter);
+                if (cls == -1 || (colFilter != "*" && col == -1)) {
+                    cout << ">> [Error] Unknown class or column.\n";
+                    break;
+                }
+
+                Timer t;
+                t.start();
+                vector<Passenger*> found = sys->queryPassengers(fromRow, toRow, cls, col);
+                t.stop();
+
+                for (Passenger* p : found) {
+                    cout << right << setw(3) << p->seatRow << left << setw(3) << p->seatCol
+                         << setw(10) << p->passengerID << setw(22) << p->name << p->flightClass << endl;
+                }
+                cout << ">> " << found.size() << " passenger(s) matched." << endl;
+                cout << ">> [Performance] Query Time: " << t.getDurationInMicroseconds() << " microseconds" << endl;
+                break;
+            }
+
+            // --- OPERATION 12: BATCH CANCEL ---
+            case 12: {
+                vector<string> ids = readIDList();
+                Timer t;
+                t.start();
+                int removed = sys->removePassengers(ids);
+                t.stop();
+                cout << ">> " << removed << " of " << ids.size() << " passenger(s) cancelled.\n";
+                cout << ">> [Performance] Batch Delete Time: " << t.getDurationInMicroseconds() << " microseconds" << endl;
+                break;
+            }
+
+            // --- OPERATION 13: BATCH SEARCH ---
+            case 13: {
+                vector<string> ids = readIDList();
+                Timer t;
+                t.start();
+                vector<Passenger*> found = sys->searchPassengers(ids);
+                t.stop();
+                for (size_t i = 0; i < ids.size(); i++) {
+                    cout << left << setw(10) << ids[i];
+                    if (found[i] == nullptr) cout << "Not found." << endl;
+                    else cout << setw(30) << found[i]->name << found[i]->seatRow << found[i]->seatCol
+                              << " (" << found[i]->flightClass << ")" << endl;
+                }
+                cout << ">> [Performance] Batch Search Time: " << t.getDurationInMicroseconds() << " microseconds" << endl;
+                break;
+            }
+
+            // --- OPERATION 14: ID FILTER METRICS ---
+            case 14: {
+                const CountingBloomFilter* f = sys->idFilter();
+                if (f == nullptr) {
+                    cout << ">> This system answers ID lookups without a filter." << endl;
+                    break;
+                }
+                cout << "\n--- ID Filter (Counting Bloom Filter) ---" << endl;
+                cout << "IDs held (seated + waitlist) : " << f->size() << " (sized for " << f->plannedIDs() << ")" << endl;
+                cout << "Counters x hashes            : " << f->counters() << " x " << f->hashCount() << " (4-bit)" << endl;
+                cout << "Memory                       : " << f->memoryBytes() << " bytes ("
+                     << fixed << setprecision(1) << (f->size() > 0 ? (double)f->memoryBytes() / f->size() : 0.0) << " per ID)" << endl;
+                cout << "Lookups answered             : " << f->lookupCount() << endl;
+                cout << "List walks skipped           : " << f->definiteMissCount() << endl;
+                cout << "False positives              : " << f->falsePositiveCount() << endl;
+                cout << "False-positive rate          : " << setprecision(2) << f->observedFPR() * 100 << "% measured, "
+                     << f->expectedFPR() * 100 << "% expected" << endl;
+                cout.unsetf(ios::fixed);
+                cout << setprecision(6);
+                break;
+            }
+
+            // --- OPERATION 15: LEAVE WAITLIST ---
+            case 15: {
+                cout << "Enter waitlisted Passenger ID: ";
+                cin >> id;
+
+                Timer t;
+                t.start();
+                bool success = sys->cancelWaitlist(id);
+                t.stop();
+
+                if (success) cout << ">> Removed from the waitlist.\n";
+                else cout << ">> Passenger is not on the waitlist.\n";
+
+                cout << ">> [Performance] Waitlist Cancel Time: " << t.getDurationInMicroseconds() << " microseconds" << endl;
+                break;
+            }
+
+            // --- OPERATION 16: PRIORITY WAITLIST MODE ---
+            case 16: {
+                bool on = !sys->priorityWaitlist();
+                if (sys->setPriorityWaitlist(on)) {
+                    if (on) cout << ">> Priority waitlist ON: a freed seat goes to the best waiter of its class (fare-paid before standby)." << endl;
+                    else cout << ">> Priority waitlist OFF: back to the system's default waitlist order." << endl;
+                }
+                break;
+            }
+
+            // --- OPERATION 17: SEAT HOLD ---
+            case 17: {
+                string action;
+                cout << "[H]old a seat, [C]onfirm a hold, [R]elease a hold: ";
+                cin >> action;
+                char a = action.empty() ? ' ' : (char)tolower(action[0]);
+
+                Timer t;
+                bool success = false;
+                if (a == 'h') {
+                    globalMaxID++;
+                    id = to_string(globalMaxID);
+                    cout << ">> Auto-Generated ID: " << id << endl;
+                    cout << "Enter Name: ";
+                    cin.ignore();
+                    getline(cin, pname);
+                    row = readRow();
+                    seatCol = readCol();
+                    fclass = readClass_FBE();
+                    int ttl;
+                    cout << "Hold for how many seconds: ";
+                    while (!(cin >> ttl) || ttl < 1) {
+                        cin.clear();
+                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                        cout << ">> [Error] Enter a whole number of seconds (1 or more): ";
+                    }
+                    t.start();
+                    success = sys->holdSeat(id, pname, row, seatCol, fclass, ttl);
+                    t.stop();
+                } else if (a == 'c' || a == 'r') {
+                    cout << "Enter Passenger ID of the hold: ";
+                    cin >> id;
+                    t.start();
+                    success = (a == 'c') ? sys->confirmHold(id) : sys->releaseHold(id);
+                    t.stop();
+                    if (!success) cout << ">> No hold found for that ID.\n";
+                } else {
+                    cout << "Invalid option!" << endl;
+                    break;
+                }
+
+                cout << ">> [Performance] Hold Operation Time: " << t.getDurationInMicroseconds() << " microseconds" << endl;
+                break;
+            }
+
+            // --- OPERATION 18: FLIGHT STATISTICS ---
+            case 18: {
+                FlightStats st;
+                Timer t;
+                t.start();
+                bool success = sys->flightStats(st);
+                t.stop();
+                if (!success) break;
+
+                cout << "\n--- Flight Statistics (" << FlightGlobal::layout().name << ") ---" << endl;
+                cout << left << setw(12) << "Class" << right << setw(8) << "Seated" << setw(8) << "Held"
+                     << setw(8) << "Free" << setw(10) << "Waiting" << endl;
+                for (int c = 0; c < CLASS_COUNT; c++) {
+                    cout << left << setw(12) << className(c) << right << setw(8) << st.seated[c] << setw(8) << st.held[c]
+                         << setw(8) << st.freeSeats[c] << setw(10) << st.waiting[c] << endl;
+                }
+                cout << left << "Waitlist total     : " << st.waitingTotal << endl;
+                cout << "Highest occupied row: " << (st.highestRow > 0 ? to_string(st.highestRow) : "-") << endl;
+                cout << ">> [Performance] Stats Time: " << t.getDurationInMicroseconds() << " microseconds" << endl;
+                break;
+            }
+
             case 0:
                 break;
             default:
@@ -269,31 +587,172 @@ void runSystem(FlightSystem* sys, string name) {
     } while (choice != 0);
 }
 
+// ==========================================
+// SERVER MODE (--serve <socket path | ->)
+// Scripted clients drive one system with the CommandServer line protocol
+// instead of the menu. Status output goes to stderr, so with "-" stdout
+// carries nothing but responses.
+// ==========================================
+void runServer(FlightSystem* sys, const string& systemName, const string& target) {
+    CommandServer server(sys);
+    server.setSystemLock(&systemsLock); // Follow mode books rows between batches
+    Timer t;
+    t.start();
+    if (target == "-") {
+        cout << ">> [Server] Reading commands from stdin (" << systemName << " system)." << endl;
+        server.serveStream(0, 1);
+    } else {
+        cout << ">> [Server] Listening on " << target << " (" << systemName << " system). Send SHUTDOWN to stop." << endl;
+        if (!server.serveUnix(target)) {
+            cout << ">> [Server] Cannot listen on " << target << "." << endl;
+            return;
+        }
+    }
+    t.stop();
+    Log::flush();
+    cout << ">> [Server] " << server.commands() << " commands in " << server.batches() << " batches ("
+         << t.getDurationInMilliseconds() << " ms)." << endl;
+}
+
 // ==========================================
 // MAIN FUNCTION
 // ==========================================
-int main() {
-    // 1. Create System Instances (Polymorphism)
-    FlightSystem* arraySys = new ArraySystem();
-    FlightSystem* listSys = new LinkedListSystem();
+int main(int argc, char* argv[]) {
+    // Log Level: --quiet (warnings and errors only) or --log-level <debug|info|warn|error|off>
+    //            while loading and in server mode (the menu shows info lines again)
+    // Change Feed: --feed <file> appends every reservation change of every system to <file>
+    // Follow Mode: --follow keeps reading rows appended to the CSV after startup
+    // Server Mode: --serve <socket path | -> [--system array|list|unrolled|skip] replaces the menu
+    string feedFile;
+    bool followMode = false;
+    string serveTarget;
+    string serveSystem = "array";
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        Log::Level level;
+        if (arg == "--quiet") Log::setLevel(Log::WARN);
+        else if (arg == "--log-level" && i + 1 < argc && Log::parseLevel(argv[i + 1], level)) {
+            Log::setLevel(level);
+            i++;
+        } else if (arg == "--feed" && i + 1 < argc) {
+            feedFile = argv[++i];
+        } else if (arg == "--follow") {
+            followMode = true;
+        } else if (arg == "--serve" && i + 1 < argc) {
+            serveTarget = argv[++i];
+        } else if (arg == "--system" && i + 1 < argc && (string(argv[i + 1]) == "array" || string(argv[i + 1]) == "list"
+                                                         || string(argv[i + 1]) == "unrolled" || string(argv[i + 1]) == "skip")) {
+            serveSystem = argv[++i];
+        } else {
+            cout << "Usage: main [--quiet] [--log-level debug|info|warn|error|off] [--feed <file>] [--follow]\n"
+                 << "            [--serve <socket path | ->] [--system array|list|unrolled|skip]" << endl;
+            return 1;
+        }
+    }
+
+    // Server mode: stdout is kept for protocol responses
+    bool interactive = serveTarget.empty();
+    if (!interactive) {
+        cout.rdbuf(cerr.rdbuf());
+        Log::setOutput(stderr);
+        signal(SIGPIPE, SIG_IGN); // A client that hangs up is an error return, not a crash
+    }
+
+    // 0. Aircraft Layout (must be set before the systems are created)
+    AircraftLayout layout;
+    if (loadLayoutFile("aircraft_layout.cfg", layout)) {
+        FlightGlobal::setLayout(layout);
+    }
+    cout << ">> Aircraft: " << FlightGlobal::layout().name << " (" << FlightGlobal::totalRows()
+         << " rows, columns " << FlightGlobal::colRangeText() << ")" << endl;
+
+    // 1. Create System Instances
+    // Concrete types are kept for bulk loading (static dispatch),
+    // the menu below works through FlightSystem* (Polymorphism).
+    ArraySystem* arraySys = new ArraySystem();
+    LinkedListSystem* listSys = new LinkedListSystem();
+    UnrolledListSystem* unrolledSys = new UnrolledListSystem();
+    SkipListSystem* skipSys = new SkipListSystem();
+
+    // Change feed consumer (follows the systems from their first booking)
+    FeedFileWriter feedWriter;
+    if (!feedFile.empty()) {
+        if (feedWriter.open(feedFile)) {
+            feedWriter.follow(*arraySys->changeFeed(), "array");
+            feedWriter.follow(*listSys->changeFeed(), "list");
+            feedWriter.follow(*unrolledSys->changeFeed(), "unrolled");
+            feedWriter.follow(*skipSys->changeFeed(), "skip");
+            feedWriter.start();
+            cout << ">> [Feed] Writing reservation changes to " << feedFile << endl;
+        } else {
+            cout << ">> [Feed] Cannot open " << feedFile << " (change feed file disabled)." << endl;
+        }
+    }
 
     // 2. Data Loading
     // NOTE: Filename is currently set to double extension (.csv.csv) based on user environment
     string filename = "flight_passenger_data.csv.csv";
     
+    // Follow mode: the file is read once (complete lines only) and the same
+    // rows go to every system; the follower then continues from that offset.
+    CsvFollowThread tail;
+    vector<string> rows;
+    if (followMode) {
+        if (!tail.reader().open(filename)) cout << ">> [Follow] " << filename << " not found yet, waiting for it." << endl;
+        tail.reader().readLines(rows);
+    }
+
     cout << ">> Initializing Array System..." << endl;
-    loadData(arraySys, filename);
+    if (followMode) cout << ">> Loaded " << ingestLines(arraySys, rows) << " passengers from " << filename << endl;
+    else loadData(arraySys, filename);
 
     cout << ">> Initializing Linked List System..." << endl;
-    loadData(listSys, filename);
+    if (followMode) cout << ">> Loaded " << ingestLines(listSys, rows) << " passengers from " << filename << endl;
+    else loadData(listSys, filename);
+
+    cout << ">> Initializing Unrolled List System..." << endl;
+    if (followMode) cout << ">> Loaded " << ingestLines(unrolledSys, rows) << " passengers from " << filename << endl;
+    else loadData(unrolledSys, filename);
+
+    cout << ">> Initializing Skip List System..." << endl;
+    if (followMode) cout << ">> Loaded " << ingestLines(skipSys, rows) << " passengers from " << filename << endl;
+    else loadData(skipSys, filename);
+
+    if (followMode) {
+        followSystems = { arraySys, listSys, unrolledSys, skipSys };
+        tail.start(bookFollowedRows);
+        cout << ">> [Follow] Watching " << filename << " for new rows ("
+             << (tail.reader().usesInotify() ? "inotify" : "polling") << ")." << endl;
+    }
+
+    // Bulk load logs through the background writer; the menu writes each
+    // line straight away so it stays in order with the prompts.
+    // --quiet / --log-level only trim the bulk load: the menu always shows
+    // its confirmations ([Success], [Waitlist], [Auto-Fill]...).
+    if (Log::dropped() > 0) cout << ">> [Log] " << Log::dropped() << " status lines dropped during loading (use --quiet)." << endl;
+    if (interactive) {
+        Log::setSynchronous(true);
+        if (Log::logger().level() > Log::INFO) Log::setLevel(Log::INFO);
+    }
 
-    // 3. Main Loop
+    // 3. Server Mode (instead of the menu)
+    if (!interactive) {
+        FlightSystem* target = arraySys;
+        if (serveSystem == "list") target = listSys;
+        else if (serveSystem == "unrolled") target = unrolledSys;
+        else if (serveSystem == "skip") target = skipSys;
+        runServer(target, serveSystem, serveTarget);
+    }
+
+    // 4. Main Loop
     int mainChoice;
-    while (true) {
+    while (interactive) {
         cout << "\n=== FLIGHT RESERVATION SYSTEM ===" << endl;
         cout << "1. ARRAY Based System (O(1) Access)" << endl;
         cout << "2. LINKED LIST Based System (Dynamic Memory)" << endl;
-        cout << "3. Exit" << endl;
+        cout << "3. UNROLLED LIST Based System (Blocks of 32)" << endl;
+        cout << "4. SKIP LIST Based System (O(log N) by ID)" << endl;
+        cout << "5. Exit" << endl;
         cout << "Select: ";
 
         if (!(cin >> mainChoice)) {
@@ -303,12 +762,23 @@ int main() {
 
         if (mainChoice == 1) runSystem(arraySys, "ARRAY SYSTEM");
         else if (mainChoice == 2) runSystem(listSys, "LINKED LIST SYSTEM");
+        else if (mainChoice == 3) runSystem(unrolledSys, "UNROLLED LIST SYSTEM");
+        else if (mainChoice == 4) runSystem(skipSys, "SKIP LIST SYSTEM");
         
-        else if (mainChoice == 3) break;
+        else if (mainChoice == 5) break;
     }
 
-    // 4. Cleanup
+    // 5. Cleanup (the feed writer reads the systems' rings: stop it first)
+    if (followMode) tail.stop();
+    if (!feedFile.empty()) {
+        feedWriter.stop();
+        cout << ">> [Feed] " << feedWriter.eventsWritten() << " changes written";
+        if (feedWriter.eventsLost() > 0) cout << ", " << feedWriter.eventsLost() << " lost (writer fell behind)";
+        cout << "." << endl;
+    }
     delete arraySys;
     delete listSys;
+    delete unrolledSys;
+    delete skipSys;
     return 0;
 }
\ No newline at end of file